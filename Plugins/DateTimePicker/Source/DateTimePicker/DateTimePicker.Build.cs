@@ -24,6 +24,11 @@ public class DateTimePicker : ModuleRules
 				"Engine",
 				"Slate",
 				"SlateCore",
+				"PropertyEditor",
+				"InputCore",
+				"UnrealEd",
+				"AssetRegistry",
+				"WorkspaceMenuStructure",
 				
 				"PickableDateTime",
 			}
@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
 #include "DetailCustomizations/PickableDateTimeDetail.h"
+#include "Timeline/PickableDateTimeTimelineTab.h"
 
 DEFINE_LOG_CATEGORY(LogDateTimePicker);
 
@@ -19,10 +20,16 @@ void FDateTimePickerModule::StartupModule()
 {
 	// Register detail customizations.
 	FPickableDateTimeDetail::Register();
+
+	// Register tabs.
+	FPickableDateTimeTimelineTab::Register();
 }
 
 void FDateTimePickerModule::ShutdownModule()
 {
+	// Unregister tabs.
+	FPickableDateTimeTimelineTab::Unregister();
+
 	// Unregister detail customizations.
 	FPickableDateTimeDetail::Unregister();
 }
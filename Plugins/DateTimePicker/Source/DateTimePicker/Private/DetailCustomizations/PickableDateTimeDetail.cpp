@@ -5,10 +5,115 @@
 #include "Modules/ModuleManager.h"
 #include "PropertyEditorModule.h"
 #include "DetailWidgetRow.h"
+#include "IPropertyUtilities.h"
+#include "ScopedTransaction.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/SNullWidget.h"
 #include "Widgets/Input/SComboButton.h"
+#include "Widgets/Input/SEditableTextBox.h"
+#include "Widgets/Layout/SBox.h"
+#include "PickableDateTimeQuickEntry.h"
+#include "PickableDateTimeImport.h"
 
 #define LOCTEXT_NAMESPACE "PickableDateTimeDetail"
 
+namespace PickableDateTimeDetailInternal
+{
+	// The date time pickers shared by all properties in the same details view.
+	static TMap<TWeakPtr<IPropertyUtilities>, TWeakPtr<SDateTimePicker>> SharedPickers;
+
+	// Returns the date time picker for the details view, creating it if it does not exist yet.
+	// The picker is kept alive by the customizations that use it and is destroyed with the details view.
+	static TSharedRef<SDateTimePicker> FindOrCreateSharedPicker(const TSharedPtr<IPropertyUtilities>& PropertyUtilities)
+	{
+		if (!PropertyUtilities.IsValid())
+		{
+			return SNew(SDateTimePicker);
+		}
+
+		for (auto It = SharedPickers.CreateIterator(); It; ++It)
+		{
+			if (!It.Key().IsValid() || !It.Value().IsValid())
+			{
+				It.RemoveCurrent();
+			}
+		}
+
+		if (const TWeakPtr<SDateTimePicker>* SharedPicker = SharedPickers.Find(PropertyUtilities))
+		{
+			return SharedPicker->Pin().ToSharedRef();
+		}
+
+		TSharedRef<SDateTimePicker> NewPicker = SNew(SDateTimePicker);
+		SharedPickers.Add(PropertyUtilities, NewPicker);
+		return NewPicker;
+	}
+
+	// Parses the name of a day of the week, accepting both full and abbreviated English names.
+	static TOptional<EDayOfWeek> ParseDayOfWeek(const FString& DayOfWeekString)
+	{
+		static const TCHAR* DayOfWeekNames[] =
+		{
+			TEXT("Monday"), TEXT("Tuesday"), TEXT("Wednesday"), TEXT("Thursday"), TEXT("Friday"), TEXT("Saturday"), TEXT("Sunday"),
+		};
+
+		const FString TrimmedString = DayOfWeekString.TrimStartAndEnd();
+		if (TrimmedString.Len() >= 3)
+		{
+			for (int32 DayIndex = 0; DayIndex < static_cast<int32>(UE_ARRAY_COUNT(DayOfWeekNames)); DayIndex++)
+			{
+				if (FString(DayOfWeekNames[DayIndex]).StartsWith(TrimmedString, ESearchCase::IgnoreCase))
+				{
+					return static_cast<EDayOfWeek>(DayIndex);
+				}
+			}
+		}
+
+		return {};
+	}
+
+	// The value content of a header row. Typing a character while the combo button has focus starts the quick entry.
+	// The key is handled by overriding the widget rather than by binding a delegate, and the text box is only
+	// created once typing starts, so rows that are never typed into stay lightweight.
+	class SValueContent : public SCompoundWidget
+	{
+	public:
+		SLATE_BEGIN_ARGS(SValueContent) {}
+			SLATE_DEFAULT_SLOT(FArguments, Content)
+		SLATE_END_ARGS()
+
+		void Construct(const FArguments& InArgs, const TSharedRef<FPickableDateTimeDetail>& InDetail)
+		{
+			Detail = InDetail;
+
+			ChildSlot
+			[
+				InArgs._Content.Widget
+			];
+		}
+
+		// SWidget interface.
+		virtual FReply OnKeyChar(const FGeometry& MyGeometry, const FCharacterEvent& InCharacterEvent) override
+		{
+			const TCHAR Character = InCharacterEvent.GetCharacter();
+			const TSharedPtr<FPickableDateTimeDetail> PinnedDetail = Detail.Pin();
+			if (!PinnedDetail.IsValid() || !FChar::IsPrint(Character) || FChar::IsWhitespace(Character))
+			{
+				return FReply::Unhandled();
+			}
+
+			PinnedDetail->BeginQuickEntry(FString::Chr(Character));
+			return FReply::Handled();
+		}
+		// End of SWidget interface.
+
+	private:
+		// The customization that owns the row.
+		TWeakPtr<FPickableDateTimeDetail> Detail;
+	};
+}
+
 void FPickableDateTimeDetail::Register()
 {
 	FPropertyEditorModule& PropertyModule = FModuleManager::LoadModuleChecked<FPropertyEditorModule>("PropertyEditor");
@@ -24,6 +129,8 @@ void FPickableDateTimeDetail::Unregister()
 	PropertyModule.UnregisterCustomPropertyTypeLayout(
 		FPickableDateTime::StaticStruct()->GetFName()
 	);
+
+	PickableDateTimeDetailInternal::SharedPickers.Empty();
 }
 
 TSharedRef<IPropertyTypeCustomization> FPickableDateTimeDetail::MakeInstance()
@@ -33,23 +140,28 @@ TSharedRef<IPropertyTypeCustomization> FPickableDateTimeDetail::MakeInstance()
 
 void FPickableDateTimeDetail::CustomizeHeader(TSharedRef<IPropertyHandle> InStructPropertyHandle, FDetailWidgetRow& HeaderRow, IPropertyTypeCustomizationUtils& StructCustomizationUtils)
 {
-	uint32 NumChildren;
-	InStructPropertyHandle->GetNumChildren(NumChildren);
+	StructPropertyHandle = InStructPropertyHandle;
+	DateTimeHandle = InStructPropertyHandle->GetChildHandle(GET_MEMBER_NAME_CHECKED(FPickableDateTime, DateTime));
+	PropertyUtilities = StructCustomizationUtils.GetPropertyUtilities();
+
+	// Parse the constraints only once here and share them with the date time picker.
+	Constraints = FPickableDateTimeConstraints::FromMetaData(
+		InStructPropertyHandle->GetMetaData(PickableDateTimeMetaData::MinDate),
+		InStructPropertyHandle->GetMetaData(PickableDateTimeMetaData::MaxDate),
+		InStructPropertyHandle->HasMetaData(PickableDateTimeMetaData::DisallowWeekends)
+	);
+
+	FirstDayOfWeek = PickableDateTimeDetailInternal::ParseDayOfWeek(InStructPropertyHandle->GetMetaData(PickableDateTimeMetaData::FirstDayOfWeek));
+	bShowWeekNumbers = InStructPropertyHandle->HasMetaData(PickableDateTimeMetaData::ShowWeekNumbers);
 
-	for (uint32 ChildIndex = 0; ChildIndex < NumChildren; ChildIndex++)
+	bLivePreview = InStructPropertyHandle->HasMetaData(PickableDateTimeMetaData::LivePreview);
+	if (InStructPropertyHandle->HasMetaData(PickableDateTimeMetaData::LivePreviewRate))
 	{
-		if (const TSharedPtr<IPropertyHandle> ChildHandle = InStructPropertyHandle->GetChildHandle(ChildIndex))
-		{
-			if (const FProperty* Property = ChildHandle->GetProperty())
-			{
-				if (Property->GetFName() == GET_MEMBER_NAME_CHECKED(FPickableDateTime, DateTime))
-				{
-					DateTimeHandle = ChildHandle;
-				}
-			}
-		}
+		const float LivePreviewRate = InStructPropertyHandle->GetFloatMetaData(PickableDateTimeMetaData::LivePreviewRate);
+		LivePreviewInterval = (LivePreviewRate > 0.f) ? (1.f / LivePreviewRate) : 0.f;
 	}
-	
+
+	// The menu content is only built when the combo button is opened, and the quick entry text box only when typing starts.
 	HeaderRow
 		.NameContent()
 		[
@@ -58,19 +170,28 @@ void FPickableDateTimeDetail::CustomizeHeader(TSharedRef<IPropertyHandle> InStru
 		.ValueContent()
 		.MinDesiredWidth(200)
 		[
-			SNew(SVerticalBox)
-			+ SVerticalBox::Slot()
-			.AutoHeight()
+			SNew(PickableDateTimeDetailInternal::SValueContent, StaticCastSharedRef<FPickableDateTimeDetail>(AsShared()))
 			[
-				SAssignNew(StructPickerAnchor, SComboButton)
-				.ContentPadding(FMargin(2, 2, 2, 1))
-				.MenuPlacement(MenuPlacement_BelowAnchor)
-				.ButtonContent()
+				SNew(SHorizontalBox)
+				+ SHorizontalBox::Slot()
+				.FillWidth(1)
 				[
-					SNew(STextBlock)
-					.Text(this, &FPickableDateTimeDetail::GetComboTextValue)
+					SAssignNew(StructPickerAnchor, SComboButton)
+					.ContentPadding(FMargin(2, 2, 2, 1))
+					.MenuPlacement(MenuPlacement_BelowAnchor)
+					.ButtonContent()
+					[
+						SNew(STextBlock)
+						.Text(this, &FPickableDateTimeDetail::GetComboTextValue)
+					]
+					.OnGetMenuContent(this, &FPickableDateTimeDetail::HandleOnGetMenuContent)
+					.OnMenuOpenChanged(bLivePreview ? FOnIsOpenChanged::CreateSP(this, &FPickableDateTimeDetail::HandleOnMenuOpenChanged) : FOnIsOpenChanged())
+				]
+				+ SHorizontalBox::Slot()
+				.AutoWidth()
+				[
+					SAssignNew(QuickEntrySlot, SBox)
 				]
-				.OnGetMenuContent(this, &FPickableDateTimeDetail::HandleOnGetMenuContent)
 			]
 		];
 }
@@ -79,66 +200,127 @@ void FPickableDateTimeDetail::CustomizeChildren(TSharedRef<IPropertyHandle> InSt
 {
 }
 
-TSharedPtr<FDateTime> FPickableDateTimeDetail::GetDateTime() const
+bool FPickableDateTimeDetail::GetDateTime(FDateTime& OutDateTime) const
 {
 	check(DateTimeHandle.IsValid());
 	
-	TArray<void*> RawData;
-	DateTimeHandle->AccessRawData(RawData);
+	// Called on every paint. GetValueData still gathers the addresses of all edited instances internally,
+	// but fails without copying a value when they differ.
+	void* RawData = nullptr;
+	if (DateTimeHandle->GetValueData(RawData) != FPropertyAccess::Success || RawData == nullptr)
+	{
+		return false;
+	}
 
-	if (RawData.Num() != 1)
+	OutDateTime = *static_cast<const FDateTime*>(RawData);
+	return true;
+}
+
+FText FPickableDateTimeDetail::GetComboTextValue() const
+{
+	// While typing in the quick entry, show the result instead of the current value.
+	if (QuickEntryPreview.IsSet())
+	{
+		return FText::Format(
+			LOCTEXT("QuickEntryPreview", "{0} (Enter to apply)"),
+			FText::AsDate(QuickEntryPreview.GetValue(), EDateTimeStyle::Default, FText::GetInvariantTimeZone())
+		);
+	}
+
+	FDateTime CurrentValue;
+	if (!GetDateTime(CurrentValue))
 	{
-		return nullptr;
+		CachedComboTicks.Reset();
+		return LOCTEXT("MultipleValues", "Multiple Values");
 	}
 
-	const auto* DateTimePtr = static_cast<FDateTime*>(RawData[0]);
-	if (DateTimePtr == nullptr)
+	if (!CachedComboTicks.IsSet() || CachedComboTicks.GetValue() != CurrentValue.GetTicks())
 	{
-		return nullptr;
+		CachedComboTicks = CurrentValue.GetTicks();
+		CachedComboText = FText::AsDate(
+			CurrentValue,
+			EDateTimeStyle::Default,
+			FText::GetInvariantTimeZone()
+		);
 	}
 
-	return MakeShared<FDateTime>(*DateTimePtr);
+	return CachedComboText;
 }
 
-FText FPickableDateTimeDetail::GetComboTextValue() const
+TSharedRef<SWidget> FPickableDateTimeDetail::HandleOnGetMenuContent()
 {
-	const TSharedPtr<FDateTime> CurrentValue = GetDateTime();
-	if (!CurrentValue.IsValid())
+	if (!SharedPicker.IsValid())
 	{
-		return LOCTEXT("MultipleValues", "Multiple Values");
+		SharedPicker = PickableDateTimeDetailInternal::FindOrCreateSharedPicker(PropertyUtilities.Pin());
 	}
-	
-	return FText::AsDate(
-		*CurrentValue,
-		EDateTimeStyle::Default,
-		FText::GetInvariantTimeZone()
+
+	FDateTime CurrentValue;
+	SharedPicker->Retarget(
+		SDateTimePicker::FArguments()
+		.InitialSelection(GetDateTime(CurrentValue) ? MakeShared<FDateTime>(CurrentValue) : TSharedPtr<FDateTime>())
+		.Constraints(Constraints)
+		.OnDateTimePicked(this, &FPickableDateTimeDetail::HandleOnDateTimePicked)
+		.OnDateTimePreviewed(bLivePreview ? SDateTimePicker::FOnDateTimePicked::CreateSP(this, &FPickableDateTimeDetail::HandleOnDateTimePreviewed) : SDateTimePicker::FOnDateTimePicked())
+		.OnCanceled(this, &FPickableDateTimeDetail::HandleOnCanceled)
+		.LivePreviewInterval(LivePreviewInterval)
+		.FirstDayOfWeek(FirstDayOfWeek)
+		.ShowWeekNumbers(bShowWeekNumbers)
 	);
+
+	return SharedPicker.ToSharedRef();
 }
 
-TSharedRef<SWidget> FPickableDateTimeDetail::HandleOnGetMenuContent()
+void FPickableDateTimeDetail::HandleOnDateTimePicked(const FDateTime& PickedDateTime)
 {
-	return
-		SNew(SDateTimePicker)
-		.InitialSelection(GetDateTime())
-		.OnDateTimePicked(this, &FPickableDateTimeDetail::HandleOnDateTimePicked);
+	// Put the values back before the transaction starts so that it records the values before the live preview.
+	RestorePreviewedValues();
+
+	// Nothing is written if the constraints allow no date at all.
+	FDateTime ClampedDateTime;
+	if (Constraints.TryClamp(PickedDateTime, ClampedDateTime))
+	{
+		// One undo step for all instances. The property handle records the objects into it and sends a single ValueSet notification.
+		const FScopedTransaction Transaction(LOCTEXT("PickDateTime", "Pick Date Time"));
+		SetDateTimeValue(ClampedDateTime, EPropertyValueSetFlags::DefaultFlags);
+	}
+
+	if (StructPickerAnchor.IsValid())
+	{
+		StructPickerAnchor->SetIsOpen(false);
+	}
 }
 
-void FPickableDateTimeDetail::HandleOnDateTimePicked(const FDateTime& PickedDateTime)
+void FPickableDateTimeDetail::HandleOnDateTimePreviewed(const FDateTime& PreviewedDateTime)
 {
 	check(DateTimeHandle.IsValid());
 
-	TArray<void*> RawData;
-	DateTimeHandle->AccessRawData(RawData);
+	FDateTime ClampedDateTime;
+	if (!Constraints.TryClamp(PreviewedDateTime, ClampedDateTime))
+	{
+		return;
+	}
 
-	DateTimeHandle->NotifyPreChange();
-	
-	for (void* RawDataInstance : RawData)
+	if (PreviewOriginalValues.Num() == 0)
 	{
-		*static_cast<FDateTime*>(RawDataInstance) = PickedDateTime;
+		TArray<void*> RawData;
+		DateTimeHandle->AccessRawData(RawData);
+
+		for (const void* RawDataInstance : RawData)
+		{
+			PreviewOriginalValues.Add(FPickableDateTimeImport::MakeText(*static_cast<const FDateTime*>(RawDataInstance)));
+		}
 	}
-	
-	DateTimeHandle->NotifyPostChange(EPropertyChangeType::ValueSet);
-	DateTimeHandle->NotifyFinishedChangingProperties();
+
+	// Interactive changes are not transacted and let listeners skip expensive work such as construction scripts.
+	SetDateTimeValue(
+		ClampedDateTime,
+		EPropertyValueSetFlags::InteractiveChange | EPropertyValueSetFlags::NotTransactable
+	);
+}
+
+void FPickableDateTimeDetail::HandleOnCanceled()
+{
+	RestorePreviewedValues();
 
 	if (StructPickerAnchor.IsValid())
 	{
@@ -146,4 +328,138 @@ void FPickableDateTimeDetail::HandleOnDateTimePicked(const FDateTime& PickedDate
 	}
 }
 
+void FPickableDateTimeDetail::HandleOnMenuOpenChanged(bool bIsOpen)
+{
+	// Closing the menu without pressing OK discards the live preview.
+	if (!bIsOpen)
+	{
+		RestorePreviewedValues();
+	}
+}
+
+bool FPickableDateTimeDetail::EvaluateQuickEntry(const FText& Text, FDateTime& OutDateTime) const
+{
+	// Relative expressions are based on the current value, or on now if multiple values are being edited.
+	FDateTime Reference;
+	if (!GetDateTime(Reference))
+	{
+		Reference = FDateTime::Now();
+	}
+
+	FDateTime EvaluatedDateTime;
+	if (!FPickableDateTimeQuickEntry::Evaluate(Text.ToString(), Reference, EvaluatedDateTime))
+	{
+		return false;
+	}
+
+	// Fails if the constraints allow no date at all.
+	return Constraints.TryClamp(EvaluatedDateTime, OutDateTime);
+}
+
+void FPickableDateTimeDetail::BeginQuickEntry(const FString& InitialText)
+{
+	check(QuickEntrySlot.IsValid());
+
+	if (QuickEntryTextBox.IsValid())
+	{
+		return;
+	}
+
+	QuickEntrySlot->SetPadding(FMargin(2, 0, 0, 0));
+	QuickEntrySlot->SetWidthOverride(80);
+	QuickEntrySlot->SetContent(
+		SAssignNew(QuickEntryTextBox, SEditableTextBox)
+		.Text(FText::FromString(InitialText))
+		.HintText(LOCTEXT("QuickEntryHint", "+3d, eom..."))
+		.ToolTipText(LOCTEXT("QuickEntryToolTip", "Enter a date such as \"+3d\", \"-2w\", \"next fri\", \"eom\" or \"2025-06\" and press Enter."))
+		.OnTextChanged(this, &FPickableDateTimeDetail::HandleOnQuickEntryTextChanged)
+		.OnTextCommitted(this, &FPickableDateTimeDetail::HandleOnQuickEntryTextCommitted)
+	);
+
+	// Keep typing after the character that started the quick entry.
+	FSlateApplication::Get().SetKeyboardFocus(QuickEntryTextBox, EFocusCause::SetDirectly);
+	QuickEntryTextBox->GoTo(ETextLocation::EndOfDocument);
+	HandleOnQuickEntryTextChanged(FText::FromString(InitialText));
+}
+
+void FPickableDateTimeDetail::HandleOnQuickEntryTextChanged(const FText& NewText)
+{
+	if (!QuickEntryTextBox.IsValid())
+	{
+		return;
+	}
+
+	QuickEntryPreview.Reset();
+	if (NewText.IsEmptyOrWhitespace())
+	{
+		QuickEntryTextBox->SetError(FText::GetEmpty());
+		return;
+	}
+
+	FDateTime EvaluatedDateTime;
+	if (EvaluateQuickEntry(NewText, EvaluatedDateTime))
+	{
+		QuickEntryPreview = EvaluatedDateTime;
+		QuickEntryTextBox->SetError(FText::GetEmpty());
+	}
+	else
+	{
+		QuickEntryTextBox->SetError(LOCTEXT("QuickEntryError", "Unrecognized date expression."));
+	}
+}
+
+void FPickableDateTimeDetail::HandleOnQuickEntryTextCommitted(const FText& NewText, ETextCommit::Type CommitType)
+{
+	// Removing the text box moves the focus away from it, which commits again.
+	if (!QuickEntryTextBox.IsValid())
+	{
+		return;
+	}
+
+	FDateTime EvaluatedDateTime;
+	if (CommitType == ETextCommit::OnEnter && EvaluateQuickEntry(NewText, EvaluatedDateTime))
+	{
+		const FScopedTransaction Transaction(LOCTEXT("QuickEntryDateTime", "Enter Date Time"));
+		SetDateTimeValue(EvaluatedDateTime, EPropertyValueSetFlags::DefaultFlags);
+	}
+
+	// The quick entry is only an input method, so always remove it once editing ends.
+	EndQuickEntry();
+}
+
+void FPickableDateTimeDetail::EndQuickEntry()
+{
+	check(QuickEntrySlot.IsValid());
+
+	QuickEntryPreview.Reset();
+	QuickEntryTextBox.Reset();
+
+	QuickEntrySlot->SetPadding(FMargin(0));
+	QuickEntrySlot->SetWidthOverride(FOptionalSize());
+	QuickEntrySlot->SetContent(SNullWidget::NullWidget);
+}
+
+void FPickableDateTimeDetail::SetDateTimeValue(const FDateTime& NewDateTime, EPropertyValueSetFlags::Type Flags)
+{
+	check(StructPropertyHandle.IsValid());
+
+	// FPickableDateTime imports the ticks directly, so no precision is lost.
+	StructPropertyHandle->SetValueFromFormattedString(FPickableDateTimeImport::MakeText(NewDateTime), Flags);
+}
+
+void FPickableDateTimeDetail::RestorePreviewedValues()
+{
+	if (PreviewOriginalValues.Num() == 0)
+	{
+		return;
+	}
+
+	check(StructPropertyHandle.IsValid());
+
+	const TArray<FString> OriginalValues = MoveTemp(PreviewOriginalValues);
+	PreviewOriginalValues.Reset();
+
+	StructPropertyHandle->SetPerObjectValues(OriginalValues, EPropertyValueSetFlags::InteractiveChange | EPropertyValueSetFlags::NotTransactable);
+}
+
 #undef LOCTEXT_NAMESPACE
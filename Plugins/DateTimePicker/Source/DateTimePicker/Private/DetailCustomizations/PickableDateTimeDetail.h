@@ -5,8 +5,13 @@
 #include "CoreMinimal.h"
 #include "DetailCustomizations.h"
 #include "IPropertyTypeCustomization.h"
+#include "PickableDateTimeConstraints.h"
 
+class SBox;
 class SComboButton;
+class SEditableTextBox;
+class SDateTimePicker;
+class IPropertyUtilities;
 class FDetailWidgetRow;
 class IDetailChildrenBuilder;
 class IPropertyHandle;
@@ -27,24 +32,94 @@ public:
 	virtual void CustomizeHeader(TSharedRef<IPropertyHandle> InStructPropertyHandle, FDetailWidgetRow& HeaderRow, IPropertyTypeCustomizationUtils& StructCustomizationUtils) override;
 	virtual void CustomizeChildren(TSharedRef<IPropertyHandle> InStructPropertyHandle, IDetailChildrenBuilder& StructBuilder, IPropertyTypeCustomizationUtils& StructCustomizationUtils) override;
 	// End of IPropertyTypeCustomization interface.
+
+	// Creates the quick entry text box next to the combo button and starts editing with the typed text.
+	void BeginQuickEntry(const FString& InitialText);
 	
 private:
-	// Get the actual value from the DateTimeHandle.
-	TSharedPtr<FDateTime> GetDateTime() const;
+	// Get the actual value from the DateTimeHandle. Returns false if multiple values are being edited.
+	bool GetDateTime(FDateTime& OutDateTime) const;
 	
 	// Returns the text displayed on the combo button.
 	FText GetComboTextValue() const;
 
-	// Create the date time picker widget.
+	// Returns the date time picker shared by the details view, creating it on first use.
 	TSharedRef<SWidget> HandleOnGetMenuContent();
 
 	// Called when a structure is selected from the list.
 	void HandleOnDateTimePicked(const FDateTime& PickedDateTime);
+
+	// Called while the user navigates the date time picker when live preview is enabled.
+	void HandleOnDateTimePreviewed(const FDateTime& PreviewedDateTime);
+
+	// Called when the user cancels the date time picker.
+	void HandleOnCanceled();
+
+	// Called when the date time picker is opened or closed when live preview is enabled.
+	void HandleOnMenuOpenChanged(bool bIsOpen);
+
+	// Evaluates the quick entry text relative to the current value and applies the constraints.
+	bool EvaluateQuickEntry(const FText& Text, FDateTime& OutDateTime) const;
+
+	// Called when the text of the quick entry is changed, previews the result on the combo button.
+	void HandleOnQuickEntryTextChanged(const FText& NewText);
+
+	// Called when the text of the quick entry is committed, writes the result when Enter is pressed.
+	void HandleOnQuickEntryTextCommitted(const FText& NewText, ETextCommit::Type CommitType);
+
+	// Destroys the quick entry text box so that the row only has the combo button again.
+	void EndQuickEntry();
+
+	// Writes the value to all instances through the property handle.
+	void SetDateTimeValue(const FDateTime& NewDateTime, EPropertyValueSetFlags::Type Flags);
+
+	// Restores the values before the live preview started.
+	void RestorePreviewedValues();
 	
 private:
+	// Handle for accessing FPickableDateTime.
+	TSharedPtr<IPropertyHandle> StructPropertyHandle;
+
 	// Handle for accessing FPickableDateTime::DateTime.
 	TSharedPtr<IPropertyHandle> DateTimeHandle;
 
+	// Constraints parsed from the metadata of the customized property.
+	FPickableDateTimeConstraints Constraints;
+
+	// The day of the week that the date time picker starts on. If not set, it depends on the culture.
+	TOptional<EDayOfWeek> FirstDayOfWeek;
+
+	// Whether to show the ISO week numbers in the date time picker.
+	bool bShowWeekNumbers = false;
+
+	// Whether to write the value while navigating the date time picker.
+	bool bLivePreview = false;
+
+	// The minimum number of seconds between live preview writes.
+	float LivePreviewInterval = 0.1f;
+
+	// The values of each instance before the live preview started. Empty if not previewing.
+	TArray<FString> PreviewOriginalValues;
+
 	// ComboButton to launch the date time picker when you click on a property.
 	TSharedPtr<SComboButton> StructPickerAnchor;
+
+	// The slot that holds the quick entry text box while it is being edited.
+	TSharedPtr<SBox> QuickEntrySlot;
+
+	// A text box to enter relative or absolute dates. Only valid while the quick entry is being edited.
+	TSharedPtr<SEditableTextBox> QuickEntryTextBox;
+
+	// The result of the quick entry being typed. Not set if nothing valid has been entered.
+	TOptional<FDateTime> QuickEntryPreview;
+
+	// The details view that displays this property.
+	TWeakPtr<IPropertyUtilities> PropertyUtilities;
+
+	// The date time picker shared with other properties in the same details view.
+	TSharedPtr<SDateTimePicker> SharedPicker;
+
+	// The ticks and text last displayed on the combo button, so that it is only formatted when the value changes.
+	mutable TOptional<int64> CachedComboTicks;
+	mutable FText CachedComboText;
 };
\ No newline at end of file
@@ -0,0 +1,171 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#include "Timeline/PickableDateTimeTimelineData.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Modules/ModuleManager.h"
+#include "Async/Async.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Sort.h"
+#include "PickableDateTimeCalendar.h"
+#include "PickableDateTimeImport.h"
+#include "PickableDateTimeAssetTags.h"
+
+void FPickableDateTimeTimelineData::GatherAsync(FName PackagePath, bool bRecursive, FOnGathered&& OnGathered)
+{
+	check(IsInGameThread());
+
+	FARFilter Filter;
+	if (!PackagePath.IsNone())
+	{
+		Filter.PackagePaths.Add(PackagePath);
+	}
+	Filter.bRecursivePaths = bRecursive;
+
+	const FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+	TArray<FAssetData> AllAssets;
+	AssetRegistryModule.Get().GetAssets(Filter, AllAssets);
+
+	// Parsing the tags dominates on large projects, so keep it off the game thread.
+	Async(
+		EAsyncExecution::ThreadPool,
+		[AllAssets = MoveTemp(AllAssets), OnGathered = MoveTemp(OnGathered)]() mutable
+		{
+			TSharedRef<FPickableDateTimeTimelineData> Data = GatherFromAssets(MoveTemp(AllAssets));
+			AsyncTask(
+				ENamedThreads::GameThread,
+				[Data, OnGathered = MoveTemp(OnGathered)]() mutable
+				{
+					OnGathered(Data);
+				}
+			);
+		}
+	);
+}
+
+TSharedRef<FPickableDateTimeTimelineData> FPickableDateTimeTimelineData::GatherFromAssets(TArray<FAssetData>&& AllAssets)
+{
+	TArray<FAssetData> FoundAssets;
+	TArray<FEntry> FoundEntries;
+	TArray<FDateTime> DateTimes;
+	TArray<FPickableDateTimeAssetTags::FValue> Values;
+	for (FAssetData& AssetData : AllAssets)
+	{
+		DateTimes.Reset();
+		Values.Reset();
+
+		// Prefer the tags exported by FPickableDateTimeAssetTags, which may duplicate the struct text of searchable properties.
+		if (FPickableDateTimeAssetTags::GetValuesFromAssetData(AssetData, Values) > 0)
+		{
+			for (const FPickableDateTimeAssetTags::FValue& Value : Values)
+			{
+				DateTimes.Add(Value.DateTime);
+			}
+		}
+		else
+		{
+			AssetData.TagsAndValues.ForEach(
+				[&DateTimes](const TPair<FName, FAssetTagValueRef>& TagAndValue)
+				{
+					ParseTagValue(*TagAndValue.Value.AsString(), DateTimes);
+				}
+			);
+		}
+
+		if (DateTimes.IsEmpty())
+		{
+			continue;
+		}
+
+		const int32 AssetIndex = FoundAssets.Add(MoveTemp(AssetData));
+		for (const FDateTime& DateTime : DateTimes)
+		{
+			FoundEntries.Add({ PickableDateTimeCalendar::ToDayNumber(DateTime), AssetIndex });
+		}
+	}
+
+	TSharedRef<FPickableDateTimeTimelineData> Data = MakeShared<FPickableDateTimeTimelineData>();
+	Data->Build(MoveTemp(FoundAssets), MoveTemp(FoundEntries));
+	return Data;
+}
+
+int32 FPickableDateTimeTimelineData::ParseTagValue(const TCHAR* TagValue, TArray<FDateTime>& OutDateTimes)
+{
+	// FPickableDateTime is exported as "(DateTime=2024.01.31-12.00.00)", and containers and outer
+	// structs nest it in more parentheses, so look for the member wherever it starts a field.
+	static constexpr TCHAR Key[] = TEXT("DateTime=");
+	static constexpr int32 KeyLength = static_cast<int32>(UE_ARRAY_COUNT(Key)) - 1;
+
+	if (TagValue == nullptr || *TagValue != TEXT('('))
+	{
+		return 0;
+	}
+
+	int32 NumFound = 0;
+	for (const TCHAR* Cursor = FCString::Strstr(TagValue, Key); Cursor != nullptr; Cursor = FCString::Strstr(Cursor, Key))
+	{
+		const bool bStartsField = (Cursor[-1] == TEXT('(') || Cursor[-1] == TEXT(','));
+		Cursor += KeyLength;
+
+		FDateTime DateTime;
+		if (bStartsField && FPickableDateTimeImport::ParseToken(Cursor, DateTime))
+		{
+			OutDateTimes.Add(DateTime);
+			NumFound++;
+		}
+	}
+
+	return NumFound;
+}
+
+void FPickableDateTimeTimelineData::Build(TArray<FAssetData>&& InAssets, TArray<FEntry>&& InEntries)
+{
+	Assets = MoveTemp(InAssets);
+	Entries = MoveTemp(InEntries);
+	Algo::SortBy(Entries, &FEntry::DayNumber);
+
+	Days.Reset();
+	CumulativeCounts.Reset();
+	for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); EntryIndex++)
+	{
+		if (Days.IsEmpty() || Days.Last() != Entries[EntryIndex].DayNumber)
+		{
+			Days.Add(Entries[EntryIndex].DayNumber);
+			CumulativeCounts.Add(EntryIndex);
+		}
+	}
+	CumulativeCounts.Add(Entries.Num());
+}
+
+int32 FPickableDateTimeTimelineData::CountInRange(int64 FirstDayNumber, int64 EndDayNumber) const
+{
+	if (Days.IsEmpty() || EndDayNumber <= FirstDayNumber)
+	{
+		return 0;
+	}
+
+	const int32 FirstIndex = Algo::LowerBound(Days, FirstDayNumber);
+	const int32 EndIndex = Algo::LowerBound(Days, EndDayNumber);
+	return CumulativeCounts[EndIndex] - CumulativeCounts[FirstIndex];
+}
+
+void FPickableDateTimeTimelineData::GetAssetsInRange(int64 FirstDayNumber, int64 EndDayNumber, TArray<FAssetData>& OutAssets) const
+{
+	if (Days.IsEmpty() || EndDayNumber <= FirstDayNumber)
+	{
+		return;
+	}
+
+	const int32 FirstEntryIndex = CumulativeCounts[Algo::LowerBound(Days, FirstDayNumber)];
+	const int32 EndEntryIndex = CumulativeCounts[Algo::LowerBound(Days, EndDayNumber)];
+
+	TBitArray<> bAdded(false, Assets.Num());
+	for (int32 EntryIndex = FirstEntryIndex; EntryIndex < EndEntryIndex; EntryIndex++)
+	{
+		const int32 AssetIndex = Entries[EntryIndex].AssetIndex;
+		if (!bAdded[AssetIndex])
+		{
+			bAdded[AssetIndex] = true;
+			OutAssets.Add(Assets[AssetIndex]);
+		}
+	}
+}
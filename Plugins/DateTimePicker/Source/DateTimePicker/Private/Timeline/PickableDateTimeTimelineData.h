@@ -0,0 +1,76 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
+
+/**
+ * Per-day histogram of the FPickableDateTime values found in the Asset Registry tags of assets.
+ * Values are read from the tags exported by FPickableDateTimeAssetTags without loading packages.
+ * Assets saved before those tags existed fall back to properties that export their struct text
+ * as a tag (e.g. UPROPERTY(AssetRegistrySearchable)).
+ * The number of values in any range of days is answered from prefix sums in O(log N), so a timeline
+ * can be rebinned on every zoom regardless of the number of values.
+ */
+class DATETIMEPICKER_API FPickableDateTimeTimelineData
+{
+public:
+	// A value found in a tag. Day numbers are the number of days since January 1, 0001.
+	struct FEntry
+	{
+		int64 DayNumber = 0;
+		int32 AssetIndex = INDEX_NONE;
+	};
+
+public:
+	// Called on the game thread with the values gathered by GatherAsync.
+	using FOnGathered = TUniqueFunction<void(TSharedRef<FPickableDateTimeTimelineData>)>;
+
+	// Scans the assets under the package path and gathers the values from their tags.
+	// Only the Asset Registry query runs on the calling game thread. The tags are parsed on a worker
+	// thread, and the callback is run on the game thread once the data has been built.
+	static void GatherAsync(FName PackagePath, bool bRecursive, FOnGathered&& OnGathered);
+
+	// Gathers the values from the tags of the assets. This can be called from any thread.
+	static TSharedRef<FPickableDateTimeTimelineData> GatherFromAssets(TArray<FAssetData>&& AllAssets);
+
+	// Appends all values of FPickableDateTime found in the tag value.
+	// Returns the number of values found.
+	static int32 ParseTagValue(const TCHAR* TagValue, TArray<FDateTime>& OutDateTimes);
+
+	// Builds the histogram from the assets and the values in them.
+	void Build(TArray<FAssetData>&& InAssets, TArray<FEntry>&& InEntries);
+
+	// Returns whether no values were found.
+	bool IsEmpty() const { return Entries.IsEmpty(); }
+
+	// Returns the number of values.
+	int32 GetNumValues() const { return Entries.Num(); }
+
+	// Returns the number of assets that have at least one value.
+	int32 GetNumAssets() const { return Assets.Num(); }
+
+	// Returns the day number of the first and last values. The data must not be empty.
+	int64 GetFirstDayNumber() const { return Days[0]; }
+	int64 GetLastDayNumber() const { return Days.Last(); }
+
+	// Returns the number of values in [FirstDayNumber, EndDayNumber).
+	int32 CountInRange(int64 FirstDayNumber, int64 EndDayNumber) const;
+
+	// Returns the assets that have values in [FirstDayNumber, EndDayNumber), without duplicates.
+	void GetAssetsInRange(int64 FirstDayNumber, int64 EndDayNumber, TArray<FAssetData>& OutAssets) const;
+
+private:
+	// The assets that have at least one value.
+	TArray<FAssetData> Assets;
+
+	// All values sorted by day.
+	TArray<FEntry> Entries;
+
+	// The days that have at least one value, in ascending order.
+	TArray<int64> Days;
+
+	// CumulativeCounts[N] is the number of values before Days[N]. It has one more element than Days.
+	TArray<int32> CumulativeCounts;
+};
@@ -0,0 +1,36 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#include "Timeline/PickableDateTimeTimelineTab.h"
+#include "Widgets/SPickableDateTimeTimelinePanel.h"
+#include "Widgets/Docking/SDockTab.h"
+#include "Framework/Docking/TabManager.h"
+#include "WorkspaceMenuStructure.h"
+#include "WorkspaceMenuStructureModule.h"
+
+#define LOCTEXT_NAMESPACE "PickableDateTimeTimelineTab"
+
+const FName FPickableDateTimeTimelineTab::TabName = TEXT("PickableDateTimeTimeline");
+
+void FPickableDateTimeTimelineTab::Register()
+{
+	FGlobalTabmanager::Get()->RegisterNomadTabSpawner(TabName, FOnSpawnTab::CreateStatic(&FPickableDateTimeTimelineTab::SpawnTab))
+		.SetDisplayName(LOCTEXT("TabTitle", "Date Time Timeline"))
+		.SetTooltipText(LOCTEXT("TabTooltip", "Shows where the date time values of the assets in a folder fall."))
+		.SetGroup(WorkspaceMenu::GetMenuStructure().GetToolsCategory());
+}
+
+void FPickableDateTimeTimelineTab::Unregister()
+{
+	FGlobalTabmanager::Get()->UnregisterNomadTabSpawner(TabName);
+}
+
+TSharedRef<SDockTab> FPickableDateTimeTimelineTab::SpawnTab(const FSpawnTabArgs& SpawnTabArgs)
+{
+	return SNew(SDockTab)
+		.TabRole(ETabRole::NomadTab)
+		[
+			SNew(SPickableDateTimeTimelinePanel)
+		];
+}
+
+#undef LOCTEXT_NAMESPACE
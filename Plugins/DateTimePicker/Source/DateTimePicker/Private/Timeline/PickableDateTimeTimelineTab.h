@@ -0,0 +1,27 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class SDockTab;
+class FSpawnTabArgs;
+
+/**
+ * Nomad tab that shows the FPickableDateTime values of assets on a timeline.
+ * It can be opened from Window > Tools > Date Time Timeline.
+ */
+class DATETIMEPICKER_API FPickableDateTimeTimelineTab
+{
+public:
+	// The name of the tab.
+	static const FName TabName;
+
+	// Register-Unregister the tab spawner.
+	static void Register();
+	static void Unregister();
+
+private:
+	// Creates the tab.
+	static TSharedRef<SDockTab> SpawnTab(const FSpawnTabArgs& SpawnTabArgs);
+};
@@ -3,9 +3,14 @@
 #include "Widgets/SDateTimePicker.h"
 #include "Components/VerticalBox.h"
 #include "Widgets/Input/SButton.h"
+#include "Widgets/Input/SEditableTextBox.h"
 #include "Widgets/Layout/SBox.h"
 #include "Widgets/Text/STextBlock.h"
 #include "Widgets/Layout/SUniformGridPanel.h"
+#include "PickableDateTimeQuickEntry.h"
+#include "PickableDateTimeCalendar.h"
+
+#define LOCTEXT_NAMESPACE "DateTimePicker"
 
 namespace DateTimePickerInternal
 {
@@ -15,8 +20,11 @@ namespace DateTimePickerInternal
 	public:
 		SLATE_BEGIN_ARGS(SDateTimeGrid) {}
 			SLATE_ARGUMENT(FDateTime, DateTime)
-			SLATE_ARGUMENT(FDateTime, PendingDateTime)
+			SLATE_ATTRIBUTE(FDateTime, PendingDateTime)
+			SLATE_ARGUMENT(FDateTime, Today)
+			SLATE_ARGUMENT(TSharedPtr<const FPickableDateTimeCalendarDescriptor>, CalendarDescriptor)
 			SLATE_ARGUMENT(bool, ShouldBeGrayOut)
+			SLATE_ARGUMENT(bool, IsDisabled)
 			SLATE_ARGUMENT(SDateTimePicker::EDateTimePickerMode, Mode)
 			SLATE_EVENT(SDateTimePicker::FOnDateTimePicked, OnDateTimePicked)
 		SLATE_END_ARGS()
@@ -54,17 +62,45 @@ namespace DateTimePickerInternal
 			default: break;
 			}
 
-			const FLinearColor GridColor = InArgs._ShouldBeGrayOut ? FLinearColor(FVector(0.3f)) : (FDateTime::Now().GetDate() == DateTime.GetDate()) ? FLinearColor(FColor::Green) : PendingDateTime.GetDate() == DateTime.GetDate() ? FLinearColor(FColor::Orange) : FLinearColor(FVector(0.8f));
+			check(InArgs._CalendarDescriptor.IsValid());
+
+			bIsDisabled = InArgs._IsDisabled;
+			bShouldBeGrayOut = InArgs._ShouldBeGrayOut;
+			bIsToday = (InArgs._Today == DateTime.GetDate());
 
 			SButton::Construct(
 				SButton::FArguments()
-				.ButtonColorAndOpacity(GridColor)
-				.Text(FText::FromString(FString::FromInt(DisplayNumber)))
+				.ButtonColorAndOpacity(this, &SDateTimeGrid::GetGridColor)
+				.IsEnabled(!InArgs._IsDisabled)
+				.Text(InArgs._CalendarDescriptor->GetNumberText(DisplayNumber))
 				.OnPressed(this, &SDateTimeGrid::HandleOnPressed)
 			);
 		}
 
 	private:
+		// The pending date is highlighted through an attribute so that the grid doesn't have to be rebuilt when it moves within the month.
+		FSlateColor GetGridColor() const
+		{
+			if (bIsDisabled)
+			{
+				return FLinearColor(FVector(0.1f));
+			}
+			if (bShouldBeGrayOut)
+			{
+				return FLinearColor(FVector(0.3f));
+			}
+			if (bIsToday)
+			{
+				return FLinearColor(FColor::Green);
+			}
+			if (PendingDateTime.Get().GetDate() == DateTime.GetDate())
+			{
+				return FLinearColor(FColor::Orange);
+			}
+
+			return FLinearColor(FVector(0.8f));
+		}
+
 		void HandleOnPressed()
 		{
 			if (OnDateTimePicked.IsBound())
@@ -75,22 +111,13 @@ namespace DateTimePickerInternal
 
 	private:
 		FDateTime DateTime;
-		FDateTime PendingDateTime;
+		TAttribute<FDateTime> PendingDateTime;
+		bool bIsDisabled = false;
+		bool bShouldBeGrayOut = false;
+		bool bIsToday = false;
 		SDateTimePicker::FOnDateTimePicked OnDateTimePicked;
 	};
 
-	// EDayOfWeek starts on Monday, so get the index starting on Sunday for the calendar.
-	static int32 GetDaysThatPassedSinceSunday(EDayOfWeek DayOfWeek)
-	{
-		int32 DaysThatPassedSinceSunday = static_cast<int32>(DayOfWeek) + 1;
-		if (DaysThatPassedSinceSunday >= 7)
-		{
-			DaysThatPassedSinceSunday = 0;
-		}
-
-		return DaysThatPassedSinceSunday;
-	}
-
 	// The dataset needed to generate the calendar.
 	struct FGenerateCalenderGrids
 	{
@@ -104,38 +131,38 @@ namespace DateTimePickerInternal
 		// Maximum number of grids.
 		int32 MaxIndex;
 		// A function that calculates the Date Time of the first grid.
-		TFunction<FDateTime(const FDateTime& PendingDateTime)> GetFirstDate;
-		// A function that determines whether to gray out a button.
-		TFunction<bool(const FDateTime& PendingDateTime, const FDateTime& DateTime)> ShouldBeGrayOut;
+		TFunction<FDateTime(const FDateTime& PendingDateTime, EDayOfWeek FirstDayOfWeek)> GetFirstDate;
+		// A function that calculates which grids to gray out. Bit N corresponds to the grid at index N.
+		TFunction<uint64(const FDateTime& PendingDateTime, const FDateTime& FirstDate)> GetGrayOutMask;
 
 		FGenerateCalenderGrids(
 			int32 InRowNum,
 			int32 InColumnNum,
 			int64 InTimespan,
 			int32 InMaxIndex = INDEX_NONE,
-			TFunction<FDateTime(const FDateTime& PendingDateTime)> InGetFirstDate = nullptr,
-			TFunction<bool(const FDateTime& PendingDateTime, const FDateTime& DateTime)> InShouldBeGrayOut = nullptr
+			TFunction<FDateTime(const FDateTime& PendingDateTime, EDayOfWeek FirstDayOfWeek)> InGetFirstDate = nullptr,
+			TFunction<uint64(const FDateTime& PendingDateTime, const FDateTime& FirstDate)> InGetGrayOutMask = nullptr
 		)
 			: RowNum(InRowNum)
 			, ColumnNum(InColumnNum)
 			, Timespan(InTimespan)
 			, MaxIndex(InMaxIndex)
 			, GetFirstDate(InGetFirstDate)
-			, ShouldBeGrayOut(InShouldBeGrayOut)
+			, GetGrayOutMask(InGetGrayOutMask)
 		{
 			if (GetFirstDate == nullptr)
 			{
-				GetFirstDate = [](const FDateTime& PendingDateTime) -> FDateTime
+				GetFirstDate = [](const FDateTime& PendingDateTime, EDayOfWeek FirstDayOfWeek) -> FDateTime
 					{
 						return PendingDateTime;
 					};
 			}
 
-			if (ShouldBeGrayOut == nullptr)
+			if (GetGrayOutMask == nullptr)
 			{
-				ShouldBeGrayOut = [](const FDateTime& PendingDateTime, const FDateTime& DateTime) -> bool
+				GetGrayOutMask = [](const FDateTime& PendingDateTime, const FDateTime& FirstDate) -> uint64
 					{
-						return false;
+						return 0;
 					};
 			}
 		}
@@ -152,15 +179,18 @@ namespace DateTimePickerInternal
 				static_cast<int32>(EDayOfWeek::Sunday), 7,
 				ETimespan::TicksPerDay,
 				INDEX_NONE,
-				[](const FDateTime& PendingDateTime) -> FDateTime
+				[](const FDateTime& PendingDateTime, EDayOfWeek FirstDayOfWeek) -> FDateTime
 				{
-					const FDateTime FirstDate(PendingDateTime.GetYear() , PendingDateTime.GetMonth(), 1);
-					const EDayOfWeek FirstDayOfWeek = FirstDate.GetDayOfWeek();
-					return FirstDate.GetTicks() - (ETimespan::TicksPerDay * static_cast<int32>(FirstDayOfWeek));//DateTimePickerInternal::GetDaysThatPassedSinceSunday(FirstDayOfWeek));
+					// Go back to the first day of the week so that the columns match the weekday headers.
+					return PickableDateTimeCalendar::GetFirstDateOfMonthGrid(PendingDateTime, FirstDayOfWeek);
 				},
-				[](const FDateTime& PendingDateTime, const FDateTime& DateTime) -> bool
+				[](const FDateTime& PendingDateTime, const FDateTime& FirstDate) -> uint64
 				{
-					return (PendingDateTime.GetMonth() != DateTime.GetMonth());
+					// Gray out all grids except the days of the pending month.
+					const int64 FirstDayOfMonth = PickableDateTimeCalendar::StartOfMonth(PickableDateTimeCalendar::ToDayNumber(PendingDateTime));
+					const int64 FirstIndex = FirstDayOfMonth - PickableDateTimeCalendar::ToDayNumber(FirstDate);
+					const int64 LastIndex = FirstIndex + FDateTime::DaysInMonth(PendingDateTime.GetYear(), PendingDateTime.GetMonth()) - 1;
+					return ~FPickableDateTimeConstraints::MakeDayGridRangeMask(FirstIndex, LastIndex);
 				}
 			)
 		},
@@ -171,54 +201,40 @@ namespace DateTimePickerInternal
 			6, 5,
 				ETimespan::TicksPerYear,
 				INDEX_NONE,
-				[](const FDateTime& PendingDateTime) -> FDateTime
+				[](const FDateTime& PendingDateTime, EDayOfWeek FirstDayOfWeek) -> FDateTime
 				{
 					const FDateTime FirstDate(PendingDateTime.GetYear() - 12, PendingDateTime.GetMonth(), PendingDateTime.GetDay());
 					return FirstDate;
 				},
-				[](const FDateTime& PendingDateTime, const FDateTime& DateTime) -> bool
+				[](const FDateTime& PendingDateTime, const FDateTime& FirstDate) -> uint64
 				{
-					return (PendingDateTime.GetYear() != DateTime.GetYear());
+					// Only the pending year, 12 grids after the first year, is not grayed out.
+					return ~(1ull << 12);
 				}
 			)
 		}
 	};
 }
 
-int32 SDateTimePicker::GetNormalizedDay(int32 inMonth)
-{
-	const int32 DaysInMonth = FDateTime::DaysInMonth(PendingDateTime.GetYear(), inMonth);
-	return PendingDateTime.GetDay() > DaysInMonth ? DaysInMonth : PendingDateTime.GetDay();
-}
-
 void SDateTimePicker::OnPressedPreviousMonth()
 {
-	const int32 NormalizedMonth = PendingDateTime.GetMonth() - 1;
-
-	if (NormalizedMonth <= 0)
-		PendingDateTime = FDateTime(PendingDateTime.GetYear() - 1, 12, GetNormalizedDay(12));
-	else
-		PendingDateTime = FDateTime(PendingDateTime.GetYear(), NormalizedMonth, GetNormalizedDay(NormalizedMonth));
-
+	PendingDateTime = PickableDateTimeCalendar::AddMonths(PendingDateTime, -1);
 	RebuildCalenderPanel();
+	NotifyPreview();
 }
 
 void SDateTimePicker::OnPressedNextMonth()
 {
-	int32 NormalizedMonth = PendingDateTime.GetMonth() % 12 + 1;
-
-	if (NormalizedMonth == 1)
-		PendingDateTime = FDateTime(PendingDateTime.GetYear() + 1, NormalizedMonth, GetNormalizedDay(NormalizedMonth));
-	else
-		PendingDateTime = FDateTime(PendingDateTime.GetYear(), NormalizedMonth, GetNormalizedDay(NormalizedMonth));
-
+	PendingDateTime = PickableDateTimeCalendar::AddMonths(PendingDateTime, 1);
 	RebuildCalenderPanel();
+	NotifyPreview();
 }
 
 void SDateTimePicker::OnPressedNow()
 {
 	PendingDateTime = FDateTime::Now();
 	RebuildCalenderPanel();
+	NotifyPreview();
 }
 
 void SDateTimePicker::OnYearChanged()
@@ -229,6 +245,8 @@ void SDateTimePicker::OnYearChanged()
 
 void SDateTimePicker::OnPressedOkay()
 {
+	CancelPendingPreview();
+
 	if (OnDateTimePicked.IsBound())
 	{
 		OnDateTimePicked.Execute(PendingDateTime);
@@ -237,7 +255,13 @@ void SDateTimePicker::OnPressedOkay()
 
 void SDateTimePicker::OnPressedCancel()
 {
-	if (OnDateTimePicked.IsBound())
+	CancelPendingPreview();
+
+	if (OnCanceled.IsBound())
+	{
+		OnCanceled.Execute();
+	}
+	else if (OnDateTimePicked.IsBound())
 	{
 		OnDateTimePicked.Execute(InitialDateTimeSelected);
 	}
@@ -245,29 +269,16 @@ void SDateTimePicker::OnPressedCancel()
 
 void SDateTimePicker::Construct(const FArguments& InArgs)
 {
-	if (InArgs._InitialSelection.IsValid())
-	{
-		PendingDateTime = *InArgs._InitialSelection;
-	}
-	else
-	{
-		PendingDateTime = FDateTime::Now();
-	}
-
-	InitialDateTimeSelected = PendingDateTime;
-
-	OnDateTimePicked = InArgs._OnDateTimePicked;
-
 	const FSlateFontInfo FontInfo(FCoreStyle::GetDefaultFontStyle("Regular", 12));
 
 	ChildSlot
 		[
 			SNew(SBox)
 				.Padding(5.f)
-				.WidthOverride(330)
-				.HeightOverride(215)
-				.MinDesiredWidth(330)
-				.MinDesiredHeight(215)
+				.WidthOverride(this, &SDateTimePicker::GetDesiredWidth)
+				.HeightOverride(240)
+				.MinDesiredWidth(this, &SDateTimePicker::GetDesiredWidth)
+				.MinDesiredHeight(240)
 				[
 					// Show year and month text and button to switch between months.
 					SNew(SVerticalBox)
@@ -312,7 +323,7 @@ void SDateTimePicker::Construct(const FArguments& InArgs)
 										.AutoWidth()
 										[
 											SNew(SButton)
-												.Text(FText::FromString(FString::FromInt(PendingDateTime.GetYear())))
+												.Text(this, &SDateTimePicker::GetYearText)
 												.OnPressed(this, &SDateTimePicker::OnYearChanged)
 										]
 
@@ -328,6 +339,18 @@ void SDateTimePicker::Construct(const FArguments& InArgs)
 								]
 						]
 
+						// A text box to enter relative or absolute dates such as "+3d", "next fri" and "eom".
+						+ SVerticalBox::Slot()
+						.AutoHeight()
+						.Padding(0, 0, 0, 2)
+						[
+							SAssignNew(QuickEntryTextBox, SEditableTextBox)
+								.HintText(LOCTEXT("QuickEntryHint", "+3d, -2w, next fri, eom, 2025-06..."))
+								.SelectAllTextWhenFocused(true)
+								.OnTextChanged(this, &SDateTimePicker::HandleOnQuickEntryTextChanged)
+								.OnTextCommitted(this, &SDateTimePicker::HandleOnQuickEntryTextCommitted)
+						]
+
 						// A grid panel that displays the date and time of the calendar.
 						+ SVerticalBox::Slot()
 						.HAlign(HAlign_Fill)
@@ -364,6 +387,40 @@ void SDateTimePicker::Construct(const FArguments& InArgs)
 		];
 
 
+	Retarget(InArgs);
+}
+
+void SDateTimePicker::Retarget(const FArguments& InArgs)
+{
+	CancelPendingPreview();
+
+	if (InArgs._InitialSelection.IsValid())
+	{
+		PendingDateTime = *InArgs._InitialSelection;
+	}
+	else
+	{
+		PendingDateTime = FDateTime::Now();
+	}
+
+	Constraints = InArgs._Constraints;
+	InitialDateTimeSelected = PendingDateTime;
+
+	OnDateTimePicked = InArgs._OnDateTimePicked;
+	OnDateTimePreviewed = InArgs._OnDateTimePreviewed;
+	OnCanceled = InArgs._OnCanceled;
+	LivePreviewInterval = FMath::Max(InArgs._LivePreviewInterval, 0.f);
+	LastPreviewTime = 0.;
+	FirstDayOfWeekOverride = InArgs._FirstDayOfWeek;
+	bShowWeekNumbers = InArgs._ShowWeekNumbers;
+	Mode = EDateTimePickerMode::Day;
+
+	if (QuickEntryTextBox.IsValid())
+	{
+		QuickEntryTextBox->SetText(FText::GetEmpty());
+		QuickEntryTextBox->SetError(FText::GetEmpty());
+	}
+
 	RebuildCalenderPanel();
 }
 
@@ -371,21 +428,64 @@ void SDateTimePicker::RebuildCalenderPanel()
 {
 	check(CalendarPanel.IsValid());
 
-	CalendarPanel->ClearChildren();
+	// Resolve everything that depends on the culture and the pending date here, so that painting does no formatting.
+	CalendarDescriptor = FPickableDateTimeCalendarDescriptor::Get();
+	const EDayOfWeek FirstDayOfWeek = FirstDayOfWeekOverride.Get(CalendarDescriptor->FirstDayOfWeek);
+
+	// The title only changes with the month, so it is only formatted when the month or the culture changes.
+	int32 Year = 0, Month = 0, Day = 0;
+	PendingDateTime.GetDate(Year, Month, Day);
+	const int32 TitleYearMonth = (Year * 12) + (Month - 1);
+	if (TitleYearMonth != CachedTitleYearMonth || CalendarDescriptor.Get() != CachedTitleDescriptor)
+	{
+		CachedTitleYearMonth = TitleYearMonth;
+		CachedTitleDescriptor = CalendarDescriptor.Get();
+		CachedYearText = CalendarDescriptor->GetNumberText(Year);
+		CachedTitleText = FText::Format(LOCTEXT("TitleFormat", "{0} {1}"), CalendarDescriptor->MonthNames[Month - 1], CachedYearText);
+	}
 
 	const DateTimePickerInternal::FGenerateCalenderGrids& Info = DateTimePickerInternal::GenerateCalenderGridsInfos[Mode];
-	const FDateTime FirstDate = Info.GetFirstDate(PendingDateTime);
+	const FDateTime FirstDate = Info.GetFirstDate(PendingDateTime, FirstDayOfWeek);
+	const FDateTime Today = FDateTime::Now().GetDate();
+
+	// Evaluate the state of all grids at once instead of for each grid.
+	const uint64 GrayOutMask = Info.GetGrayOutMask(PendingDateTime, FirstDate);
+	const uint64 DisabledMask = (Mode == EDateTimePickerMode::Day) ? Constraints.GetDisabledDayMask(FirstDate) : 0;
+
+	// The week number column is only shown in the day mode.
+	const bool bWeekNumberColumn = (bShowWeekNumbers && Mode == EDateTimePickerMode::Day);
+	const int32 FirstGridColumn = bWeekNumberColumn ? 1 : 0;
+
+	// Reopening the picker or moving the selection within the same month shows the same grids, so keep them.
+	const FCalendarPanelState PanelState = { Mode, FirstDate, Today, FirstDayOfWeek, GrayOutMask, DisabledMask, bWeekNumberColumn, CalendarDescriptor.Get() };
+	if (BuiltPanelState.IsSet() && BuiltPanelState.GetValue() == PanelState)
+	{
+		return;
+	}
+	BuiltPanelState = PanelState;
+
+	CalendarPanel->ClearChildren();
 
 	//Add day name
 	if (Mode == EDateTimePickerMode::Day)
 	{
+		if (bWeekNumberColumn)
+		{
+			CalendarPanel->AddSlot(0, 0)
+				[
+					SNew(STextBlock)
+						.Text(CalendarDescriptor->WeekNumberHeader)
+						.Justification(ETextJustify::Center)
+				];
+		}
+
 		for (int32 Day = 0; Day < Info.ColumnNum; Day++)
 		{
-			FString DayOfWeek = ShortDayNames[Day];
-			CalendarPanel->AddSlot(Day, 0)
+			const EDayOfWeek DayOfWeek = FPickableDateTimeCalendarDescriptor::GetDayOfWeekOfColumn(FirstDayOfWeek, Day);
+			CalendarPanel->AddSlot(FirstGridColumn + Day, 0)
 				[
 					SNew(STextBlock)
-						.Text(FText::FromString(DayOfWeek))
+						.Text(CalendarDescriptor->ShortDayNames[static_cast<int32>(DayOfWeek)])
 						.Justification(ETextJustify::Center)
 				];
 		}
@@ -394,6 +494,22 @@ void SDateTimePicker::RebuildCalenderPanel()
 	// Fill the contents of the calendar.
 	for (int32 Row = 0; Row < Info.RowNum; Row++)
 	{
+		if (bWeekNumberColumn)
+		{
+			// The ISO week of a row is the week of the Thursday in it.
+			const FDateTime RowStart = FirstDate.GetTicks() + (Info.Timespan * Row * Info.ColumnNum);
+			const int32 ThursdayColumn = FPickableDateTimeCalendarDescriptor::GetColumnOfDayOfWeek(FirstDayOfWeek, EDayOfWeek::Thursday);
+			const int32 WeekNumber = FPickableDateTimeCalendarDescriptor::GetIsoWeekNumber(RowStart + FTimespan::FromDays(ThursdayColumn));
+			CalendarPanel->AddSlot(0, Row + 1)
+				.VAlign(VAlign_Center)
+				[
+					SNew(STextBlock)
+						.Text(CalendarDescriptor->GetNumberText(WeekNumber))
+						.Justification(ETextJustify::Center)
+						.ColorAndOpacity(FSlateColor::UseSubduedForeground())
+				];
+		}
+
 		for (int32 Column = 0; Column < Info.ColumnNum; Column++)
 		{
 			const int32 Index = (Row * Info.ColumnNum) + Column;
@@ -403,37 +519,142 @@ void SDateTimePicker::RebuildCalenderPanel()
 			}
 
 			const FDateTime DateTime = (Mode == EDateTimePickerMode::Day) ? FirstDate.GetTicks() + (Info.Timespan * Index) : FirstDate + FTimespan::FromDays(365.25 * Index);
-			CalendarPanel->AddSlot(Column, Row + 1)
+			CalendarPanel->AddSlot(FirstGridColumn + Column, Row + 1)
 				[
 					SNew(DateTimePickerInternal::SDateTimeGrid)
 						.DateTime(DateTime)
-						.ShouldBeGrayOut(Info.ShouldBeGrayOut(PendingDateTime, DateTime))
+						.Today(Today)
+						.CalendarDescriptor(CalendarDescriptor)
+						.ShouldBeGrayOut(((GrayOutMask >> Index) & 1) != 0)
+						.IsDisabled(((DisabledMask >> Index) & 1) != 0)
 						.Mode(Mode)
-						.PendingDateTime(PendingDateTime)
+						.PendingDateTime(this, &SDateTimePicker::GetPendingDateTime)
 						.OnDateTimePicked(this, &SDateTimePicker::HandleOnDateTimePicked)
 				];
 		}
 	}
 }
 
+FDateTime SDateTimePicker::GetPendingDateTime() const
+{
+	return PendingDateTime;
+}
+
 FText SDateTimePicker::GetTitleText() const
 {
-	return FText::AsDate(
-		PendingDateTime,
-		EDateTimeStyle::Medium,
-		FText::GetInvariantTimeZone()
-	);
+	return CachedTitleText;
+}
+
+FText SDateTimePicker::GetYearText() const
+{
+	return CachedYearText;
+}
+
+FOptionalSize SDateTimePicker::GetDesiredWidth() const
+{
+	return bShowWeekNumbers ? 370.f : 330.f;
 }
 
 void SDateTimePicker::HandleOnDateTimePicked(const FDateTime& PickedDateTime)
 {
 	if (OnDateTimePicked.IsBound())
 	{
-		PendingDateTime = PickedDateTime;
+		PendingDateTime = Constraints.Clamp(PickedDateTime);
 
 		if (Mode == EDateTimePickerMode::Year)
 			Mode = EDateTimePickerMode::Day;
 
 		RebuildCalenderPanel();
+		NotifyPreview();
+	}
+}
+
+void SDateTimePicker::HandleOnQuickEntryTextChanged(const FText& NewText)
+{
+	check(QuickEntryTextBox.IsValid());
+
+	const FString& Expression = NewText.ToString();
+	if (Expression.TrimStartAndEnd().IsEmpty())
+	{
+		QuickEntryTextBox->SetError(FText::GetEmpty());
+		return;
+	}
+
+	// Evaluate relative to the value when the picker was opened so that the result does not drift while typing.
+	FDateTime EvaluatedDateTime;
+	if (!FPickableDateTimeQuickEntry::Evaluate(Expression, InitialDateTimeSelected, EvaluatedDateTime))
+	{
+		QuickEntryTextBox->SetError(LOCTEXT("QuickEntryError", "Unrecognized date expression."));
+		return;
+	}
+
+	QuickEntryTextBox->SetError(FText::GetEmpty());
+
+	PendingDateTime = Constraints.Clamp(EvaluatedDateTime);
+	Mode = EDateTimePickerMode::Day;
+
+	RebuildCalenderPanel();
+	NotifyPreview();
+}
+
+void SDateTimePicker::HandleOnQuickEntryTextCommitted(const FText& NewText, ETextCommit::Type CommitType)
+{
+	if (CommitType != ETextCommit::OnEnter)
+	{
+		return;
+	}
+
+	FDateTime EvaluatedDateTime;
+	if (FPickableDateTimeQuickEntry::Evaluate(NewText.ToString(), InitialDateTimeSelected, EvaluatedDateTime))
+	{
+		OnPressedOkay();
+	}
+}
+
+void SDateTimePicker::NotifyPreview()
+{
+	if (!OnDateTimePreviewed.IsBound() || PreviewTimerHandle.IsValid())
+	{
+		return;
+	}
+
+	// Notify immediately if enough time has passed, otherwise notify the latest value when the interval elapses.
+	const double ElapsedTime = FPlatformTime::Seconds() - LastPreviewTime;
+	if (ElapsedTime >= LivePreviewInterval)
+	{
+		LastPreviewTime = FPlatformTime::Seconds();
+		OnDateTimePreviewed.Execute(PendingDateTime);
+	}
+	else
+	{
+		PreviewTimerHandle = RegisterActiveTimer(
+			static_cast<float>(LivePreviewInterval - ElapsedTime),
+			FWidgetActiveTimerDelegate::CreateSP(this, &SDateTimePicker::HandleOnPreviewTimer)
+		);
 	}
 }
+
+EActiveTimerReturnType SDateTimePicker::HandleOnPreviewTimer(double InCurrentTime, float InDeltaTime)
+{
+	PreviewTimerHandle.Reset();
+
+	if (OnDateTimePreviewed.IsBound())
+	{
+		LastPreviewTime = FPlatformTime::Seconds();
+		OnDateTimePreviewed.Execute(PendingDateTime);
+	}
+
+	return EActiveTimerReturnType::Stop;
+}
+
+void SDateTimePicker::CancelPendingPreview()
+{
+	if (const TSharedPtr<FActiveTimerHandle> ActiveTimerHandle = PreviewTimerHandle.Pin())
+	{
+		UnRegisterActiveTimer(ActiveTimerHandle.ToSharedRef());
+	}
+
+	PreviewTimerHandle.Reset();
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,470 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#include "Widgets/SPickableDateTimeTimeline.h"
+#include "Timeline/PickableDateTimeTimelineData.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Rendering/DrawElements.h"
+#include "Styling/CoreStyle.h"
+#include "Algo/BinarySearch.h"
+#include "PickableDateTimeCalendar.h"
+
+#define LOCTEXT_NAMESPACE "PickableDateTimeTimeline"
+
+namespace PickableDateTimeTimelineInternal
+{
+	// A bin size of the histogram. Exactly one of NumDays and NumMonths is used.
+	struct FBinLevel
+	{
+		int32 NumDays;
+		int32 NumMonths;
+		double ApproximateNumDays;
+		const TCHAR* LabelFormat;
+	};
+
+	// Bin sizes from the finest to the coarsest.
+	static const FBinLevel BinLevels[] =
+	{
+		{ 1, 0, 1., TEXT("%Y-%m-%d") },
+		{ 7, 0, 7., TEXT("%Y-%m-%d") },
+		{ 0, 1, 30.44, TEXT("%Y-%m") },
+		{ 0, 3, 91.31, TEXT("%Y-%m") },
+		{ 0, 12, 365.25, TEXT("%Y") },
+		{ 0, 120, 3652.5, TEXT("%Y") },
+	};
+
+	// The minimum width of a bar, which decides the bin size.
+	static constexpr float MinBinWidth = 4.f;
+
+	// The minimum distance between the labels on the axis.
+	static constexpr float MinLabelSpacing = 90.f;
+
+	// The height of the axis labels at the bottom.
+	static constexpr float AxisHeight = 18.f;
+
+	// The height of the hover information at the top.
+	static constexpr float InfoHeight = 18.f;
+
+	// The limits of zooming in.
+	static constexpr double MinDaysPerPixel = 1. / 64.;
+
+	// The range of days that FDateTime can represent.
+	static constexpr int64 MinDayNumber = 0;
+	static constexpr int64 EndDayNumber = PickableDateTimeCalendar::DaysFromCivil(10000, 1, 1);
+
+	// Returns the first bin edge at or before the day.
+	static int64 AlignToBinLevel(int64 DayNumber, const FBinLevel& BinLevel)
+	{
+		if (BinLevel.NumMonths == 0)
+		{
+			// Day number 0 is a Monday, so weeks start on Monday.
+			return DayNumber - (DayNumber % BinLevel.NumDays);
+		}
+
+		int32 Year = 0, Month = 0, Day = 0;
+		PickableDateTimeCalendar::CivilFromDays(DayNumber, Year, Month, Day);
+
+		int64 TotalMonths = (static_cast<int64>(Year) * 12) + (Month - 1);
+		TotalMonths -= (TotalMonths % BinLevel.NumMonths);
+		return FMath::Max(PickableDateTimeCalendar::DaysFromCivil(static_cast<int32>(TotalMonths / 12), static_cast<int32>(TotalMonths % 12) + 1, 1), MinDayNumber);
+	}
+
+	// Returns the next bin edge after the edge.
+	static int64 StepBinLevel(int64 DayNumber, const FBinLevel& BinLevel)
+	{
+		if (BinLevel.NumMonths == 0)
+		{
+			return DayNumber + BinLevel.NumDays;
+		}
+
+		return PickableDateTimeCalendar::AddMonths(DayNumber, BinLevel.NumMonths);
+	}
+}
+
+void SPickableDateTimeTimeline::Construct(const FArguments& InArgs)
+{
+	OnBinClicked = InArgs._OnBinClicked;
+	SetData(InArgs._Data);
+}
+
+void SPickableDateTimeTimeline::SetData(const TSharedPtr<const FPickableDateTimeTimelineData>& InData)
+{
+	Data = InData;
+	HoveredBinIndex = INDEX_NONE;
+	CachedSize = FVector2f(-1.f);
+	bInfoTextDirty = true;
+	ZoomToFit();
+}
+
+void SPickableDateTimeTimeline::SetIsLoading(bool bInIsLoading)
+{
+	if (bIsLoading != bInIsLoading)
+	{
+		bIsLoading = bInIsLoading;
+		bInfoTextDirty = true;
+		OnViewChanged();
+	}
+}
+
+void SPickableDateTimeTimeline::ZoomToFit()
+{
+	if (ViewWidth <= 0.f)
+	{
+		bZoomToFitPending = true;
+		return;
+	}
+
+	int64 FirstDayNumber = 0;
+	int64 LastDayNumber = 0;
+	if (Data.IsValid() && !Data->IsEmpty())
+	{
+		FirstDayNumber = Data->GetFirstDayNumber();
+		LastDayNumber = Data->GetLastDayNumber();
+	}
+	else
+	{
+		// Show the current year when there is nothing to fit.
+		const int64 Today = PickableDateTimeCalendar::ToDayNumber(FDateTime::Today());
+		FirstDayNumber = PickableDateTimeCalendar::StartOfYear(Today);
+		LastDayNumber = PickableDateTimeCalendar::AddMonths(FirstDayNumber, 12) - 1;
+	}
+
+	const double Margin = FMath::Max(1., (LastDayNumber - FirstDayNumber + 1) * 0.05);
+	ViewFirstDayNumber = FirstDayNumber - Margin;
+	DaysPerPixel = ((LastDayNumber + 1 + Margin) - ViewFirstDayNumber) / ViewWidth;
+	bZoomToFitPending = false;
+
+	ClampView();
+	OnViewChanged();
+}
+
+void SPickableDateTimeTimeline::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+{
+	ViewWidth = AllottedGeometry.GetLocalSize().X;
+	if (bZoomToFitPending && ViewWidth > 0.f)
+	{
+		ZoomToFit();
+	}
+}
+
+int32 SPickableDateTimeTimeline::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+	using namespace PickableDateTimeTimelineInternal;
+
+	const FVector2f Size = AllottedGeometry.GetLocalSize();
+	const FSlateBrush* WhiteBrush = FCoreStyle::Get().GetBrush("GenericWhiteBox");
+	const FSlateFontInfo FontInfo(FCoreStyle::GetDefaultFontStyle("Regular", 8));
+	const FLinearColor TextColor = InWidgetStyle.GetColorAndOpacityTint() * FLinearColor(0.7f, 0.7f, 0.7f);
+
+	FSlateDrawElement::MakeBox(
+		OutDrawElements,
+		LayerId,
+		AllottedGeometry.ToPaintGeometry(),
+		WhiteBrush,
+		ESlateDrawEffect::None,
+		FLinearColor(0.015f, 0.015f, 0.015f)
+	);
+
+	UpdateBins(Size);
+	UpdateInfoText();
+
+	// Bars, scaled so that the largest bin fills the plot area.
+	const float PlotTop = InfoHeight;
+	const float PlotHeight = FMath::Max(Size.Y - AxisHeight - InfoHeight, 1.f);
+	for (int32 BinIndex = 0; BinIndex < BinCounts.Num(); BinIndex++)
+	{
+		if (BinCounts[BinIndex] == 0)
+		{
+			continue;
+		}
+
+		const float Left = FMath::Max(DayNumberToLocalX(BinEdges[BinIndex]), 0.f);
+		const float Right = FMath::Min(DayNumberToLocalX(BinEdges[BinIndex + 1]), Size.X);
+		const float Height = FMath::Max(PlotHeight * BinCounts[BinIndex] / MaxBinCount, 1.f);
+		const FLinearColor BarColor = (BinIndex == HoveredBinIndex) ? FLinearColor(1.f, 0.6f, 0.1f) : FLinearColor(0.15f, 0.45f, 0.9f);
+
+		FSlateDrawElement::MakeBox(
+			OutDrawElements,
+			LayerId + 1,
+			AllottedGeometry.ToPaintGeometry(FVector2f(FMath::Max(Right - Left - 1.f, 1.f), Height), FSlateLayoutTransform(FVector2f(Left, PlotTop + PlotHeight - Height))),
+			WhiteBrush,
+			ESlateDrawEffect::None,
+			InWidgetStyle.GetColorAndOpacityTint() * BarColor
+		);
+	}
+
+	for (const FAxisLabel& AxisLabel : AxisLabels)
+	{
+		FSlateDrawElement::MakeLines(OutDrawElements, LayerId, AllottedGeometry.ToPaintGeometry(), AxisLabel.TickPoints, ESlateDrawEffect::None, FLinearColor(0.06f, 0.06f, 0.06f));
+
+		FSlateDrawElement::MakeText(
+			OutDrawElements,
+			LayerId + 2,
+			AllottedGeometry.ToPaintGeometry(FVector2f(MinLabelSpacing, AxisHeight), FSlateLayoutTransform(AxisLabel.Position)),
+			AxisLabel.Text,
+			FontInfo,
+			ESlateDrawEffect::None,
+			TextColor
+		);
+	}
+
+	if (!TodayPoints.IsEmpty())
+	{
+		FSlateDrawElement::MakeLines(OutDrawElements, LayerId + 2, AllottedGeometry.ToPaintGeometry(), TodayPoints, ESlateDrawEffect::None, FLinearColor(0.9f, 0.2f, 0.2f));
+	}
+
+	if (!InfoText.IsEmpty())
+	{
+		FSlateDrawElement::MakeText(
+			OutDrawElements,
+			LayerId + 2,
+			AllottedGeometry.ToPaintGeometry(FVector2f(Size.X, InfoHeight), FSlateLayoutTransform(FVector2f(4.f, 2.f))),
+			InfoText,
+			FontInfo,
+			ESlateDrawEffect::None,
+			TextColor
+		);
+	}
+
+	return LayerId + 2;
+}
+
+FReply SPickableDateTimeTimeline::OnMouseWheel(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+	// Zoom around the cursor.
+	const float LocalX = MyGeometry.AbsoluteToLocal(MouseEvent.GetScreenSpacePosition()).X;
+	const double DayNumberAtCursor = ViewFirstDayNumber + (LocalX * DaysPerPixel);
+
+	DaysPerPixel *= (MouseEvent.GetWheelDelta() > 0.f) ? 0.8 : 1.25;
+	ClampView();
+	ViewFirstDayNumber = DayNumberAtCursor - (LocalX * DaysPerPixel);
+	ClampView();
+
+	OnViewChanged();
+	return FReply::Handled();
+}
+
+FReply SPickableDateTimeTimeline::OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+	if (MouseEvent.GetEffectingButton() != EKeys::LeftMouseButton)
+	{
+		return FReply::Unhandled();
+	}
+
+	bIsDragging = false;
+	DragStartLocalX = MyGeometry.AbsoluteToLocal(MouseEvent.GetScreenSpacePosition()).X;
+	DragStartFirstDayNumber = ViewFirstDayNumber;
+	return FReply::Handled().CaptureMouse(SharedThis(this));
+}
+
+FReply SPickableDateTimeTimeline::OnMouseButtonUp(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+	if (MouseEvent.GetEffectingButton() != EKeys::LeftMouseButton || !HasMouseCapture())
+	{
+		return FReply::Unhandled();
+	}
+
+	if (!bIsDragging)
+	{
+		const int32 BinIndex = FindBinAt(MyGeometry.AbsoluteToLocal(MouseEvent.GetScreenSpacePosition()).X);
+		if (BinCounts.IsValidIndex(BinIndex) && BinCounts[BinIndex] > 0)
+		{
+			OnBinClicked.ExecuteIfBound(BinEdges[BinIndex], BinEdges[BinIndex + 1]);
+		}
+	}
+
+	bIsDragging = false;
+	return FReply::Handled().ReleaseMouseCapture();
+}
+
+FReply SPickableDateTimeTimeline::OnMouseButtonDoubleClick(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+	ZoomToFit();
+	return FReply::Handled();
+}
+
+FReply SPickableDateTimeTimeline::OnMouseMove(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+	const float LocalX = MyGeometry.AbsoluteToLocal(MouseEvent.GetScreenSpacePosition()).X;
+
+	if (HasMouseCapture())
+	{
+		if (!bIsDragging && FMath::Abs(LocalX - DragStartLocalX) > FSlateApplication::Get().GetDragTriggerDistance())
+		{
+			bIsDragging = true;
+		}
+
+		if (bIsDragging)
+		{
+			ViewFirstDayNumber = DragStartFirstDayNumber - ((LocalX - DragStartLocalX) * DaysPerPixel);
+			ClampView();
+		}
+	}
+
+	const int32 NewHoveredBinIndex = bIsDragging ? INDEX_NONE : FindBinAt(LocalX);
+	if (bIsDragging || NewHoveredBinIndex != HoveredBinIndex)
+	{
+		HoveredBinIndex = NewHoveredBinIndex;
+		OnViewChanged();
+	}
+
+	return HasMouseCapture() ? FReply::Handled() : FReply::Unhandled();
+}
+
+void SPickableDateTimeTimeline::OnMouseLeave(const FPointerEvent& MouseEvent)
+{
+	SLeafWidget::OnMouseLeave(MouseEvent);
+
+	if (HoveredBinIndex != INDEX_NONE)
+	{
+		HoveredBinIndex = INDEX_NONE;
+		OnViewChanged();
+	}
+}
+
+FVector2D SPickableDateTimeTimeline::ComputeDesiredSize(float LayoutScaleMultiplier) const
+{
+	return FVector2D(600.f, 200.f);
+}
+
+void SPickableDateTimeTimeline::UpdateBins(const FVector2f& Size) const
+{
+	using namespace PickableDateTimeTimelineInternal;
+
+	const int64 TodayDayNumber = PickableDateTimeCalendar::ToDayNumber(FDateTime::Today());
+	if (Size == CachedSize && ViewFirstDayNumber == CachedFirstDayNumber && DaysPerPixel == CachedDaysPerPixel && TodayDayNumber == CachedTodayDayNumber)
+	{
+		return;
+	}
+
+	CachedSize = Size;
+	CachedFirstDayNumber = ViewFirstDayNumber;
+	CachedDaysPerPixel = DaysPerPixel;
+	CachedTodayDayNumber = TodayDayNumber;
+	bInfoTextDirty = true;
+
+	// Use the finest bin size whose bars are wide enough.
+	BinLevelIndex = UE_ARRAY_COUNT(BinLevels) - 1;
+	for (int32 LevelIndex = 0; LevelIndex < static_cast<int32>(UE_ARRAY_COUNT(BinLevels)); LevelIndex++)
+	{
+		if ((BinLevels[LevelIndex].ApproximateNumDays / DaysPerPixel) >= MinBinWidth)
+		{
+			BinLevelIndex = LevelIndex;
+			break;
+		}
+	}
+
+	const FBinLevel& BinLevel = BinLevels[BinLevelIndex];
+	const int64 FirstVisibleDayNumber = FMath::Clamp(FMath::FloorToInt64(ViewFirstDayNumber), MinDayNumber, EndDayNumber);
+	const int64 EndVisibleDayNumber = FMath::Clamp(FMath::CeilToInt64(ViewFirstDayNumber + (Size.X * DaysPerPixel)), MinDayNumber, EndDayNumber);
+
+	BinEdges.Reset();
+	BinCounts.Reset();
+	MaxBinCount = 0;
+
+	int64 BinEdge = AlignToBinLevel(FirstVisibleDayNumber, BinLevel);
+	BinEdges.Add(BinEdge);
+	while (BinEdge < EndVisibleDayNumber)
+	{
+		const int64 NextBinEdge = FMath::Min(StepBinLevel(BinEdge, BinLevel), EndDayNumber);
+		const int32 Count = Data.IsValid() ? Data->CountInRange(BinEdge, NextBinEdge) : 0;
+
+		BinCounts.Add(Count);
+		BinEdges.Add(NextBinEdge);
+		MaxBinCount = FMath::Max(MaxBinCount, Count);
+		BinEdge = NextBinEdge;
+	}
+
+	// Axis labels at the bin edges, skipping edges that are too close to the previous label.
+	const float PlotTop = InfoHeight;
+	const float PlotHeight = FMath::Max(Size.Y - AxisHeight - InfoHeight, 1.f);
+	AxisLabels.Reset();
+	float LastLabelX = -MinLabelSpacing;
+	for (const int64 Edge : BinEdges)
+	{
+		const float X = DayNumberToLocalX(Edge);
+		if (X < 0.f || X > Size.X || (X - LastLabelX) < MinLabelSpacing)
+		{
+			continue;
+		}
+		LastLabelX = X;
+
+		FAxisLabel& AxisLabel = AxisLabels.AddDefaulted_GetRef();
+		AxisLabel.Position = FVector2f(X + 2.f, Size.Y - AxisHeight + 2.f);
+		AxisLabel.Text = PickableDateTimeCalendar::FromDayNumber(Edge).ToString(BinLevel.LabelFormat);
+		AxisLabel.TickPoints = { FVector2f(X, PlotTop), FVector2f(X, Size.Y) };
+	}
+
+	// A marker for today.
+	TodayPoints.Reset();
+	const float TodayX = DayNumberToLocalX(TodayDayNumber);
+	if (TodayX >= 0.f && TodayX <= Size.X)
+	{
+		TodayPoints = { FVector2f(TodayX, PlotTop), FVector2f(TodayX, PlotTop + PlotHeight) };
+	}
+}
+
+void SPickableDateTimeTimeline::UpdateInfoText() const
+{
+	if (!bInfoTextDirty && HoveredBinIndex == InfoBinIndex)
+	{
+		return;
+	}
+
+	bInfoTextDirty = false;
+	InfoBinIndex = HoveredBinIndex;
+
+	// Information about the hovered bar, or a hint when there is nothing to show.
+	if (bIsLoading)
+	{
+		InfoText = LOCTEXT("Loading", "Scanning assets...");
+	}
+	else if (BinCounts.IsValidIndex(HoveredBinIndex))
+	{
+		const FString FirstDateString = PickableDateTimeCalendar::FromDayNumber(BinEdges[HoveredBinIndex]).ToString(TEXT("%Y-%m-%d"));
+		const FString LastDateString = PickableDateTimeCalendar::FromDayNumber(BinEdges[HoveredBinIndex + 1] - 1).ToString(TEXT("%Y-%m-%d"));
+		InfoText = (FirstDateString == LastDateString)
+			? FText::Format(LOCTEXT("DayInfoFormat", "{0}: {1} values"), FText::FromString(FirstDateString), FText::AsNumber(BinCounts[HoveredBinIndex]))
+			: FText::Format(LOCTEXT("RangeInfoFormat", "{0} - {1}: {2} values"), FText::FromString(FirstDateString), FText::FromString(LastDateString), FText::AsNumber(BinCounts[HoveredBinIndex]));
+	}
+	else if (!Data.IsValid() || Data->IsEmpty())
+	{
+		InfoText = LOCTEXT("NoValues", "No values found.");
+	}
+	else
+	{
+		InfoText = FText::GetEmpty();
+	}
+}
+
+int32 SPickableDateTimeTimeline::FindBinAt(float LocalX) const
+{
+	if (BinCounts.IsEmpty())
+	{
+		return INDEX_NONE;
+	}
+
+	const int64 DayNumber = FMath::FloorToInt64(ViewFirstDayNumber + (LocalX * DaysPerPixel));
+	const int32 BinIndex = Algo::UpperBound(BinEdges, DayNumber) - 1;
+	return BinCounts.IsValidIndex(BinIndex) ? BinIndex : INDEX_NONE;
+}
+
+float SPickableDateTimeTimeline::DayNumberToLocalX(int64 DayNumber) const
+{
+	return static_cast<float>((DayNumber - ViewFirstDayNumber) / DaysPerPixel);
+}
+
+void SPickableDateTimeTimeline::ClampView()
+{
+	using namespace PickableDateTimeTimelineInternal;
+
+	const double Width = FMath::Max(ViewWidth, 1.f);
+	DaysPerPixel = FMath::Clamp(DaysPerPixel, MinDaysPerPixel, (EndDayNumber - MinDayNumber) / Width);
+	ViewFirstDayNumber = FMath::Clamp(ViewFirstDayNumber, static_cast<double>(MinDayNumber), EndDayNumber - (Width * DaysPerPixel));
+}
+
+void SPickableDateTimeTimeline::OnViewChanged()
+{
+	Invalidate(EInvalidateWidgetReason::Paint);
+}
+
+#undef LOCTEXT_NAMESPACE
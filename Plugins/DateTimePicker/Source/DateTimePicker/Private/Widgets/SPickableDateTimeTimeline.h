@@ -0,0 +1,139 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SLeafWidget.h"
+
+class FPickableDateTimeTimelineData;
+
+/**
+ * Widget that draws a zoomable histogram of the values of FPickableDateTimeTimelineData.
+ * The values are binned by day, week, month, quarter, year or decade depending on the zoom level,
+ * so the number of bars is bounded by the width of the widget rather than by the number of values.
+ * Scroll to zoom, drag to pan, double-click to fit the data and click a bar to pick its range.
+ */
+class DATETIMEPICKER_API SPickableDateTimeTimeline : public SLeafWidget
+{
+public:
+	// Defines an event to be called when a bar is clicked, with the range of days [FirstDayNumber, EndDayNumber).
+	DECLARE_DELEGATE_TwoParams(FOnBinClicked, int64 /* FirstDayNumber */, int64 /* EndDayNumber */);
+
+public:
+	SLATE_BEGIN_ARGS(SPickableDateTimeTimeline) {}
+
+	// The values to display.
+	SLATE_ARGUMENT(TSharedPtr<const FPickableDateTimeTimelineData>, Data)
+
+	// Called when a bar that has values is clicked.
+	SLATE_EVENT(FOnBinClicked, OnBinClicked)
+
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	// Replaces the values to display and zooms to fit them.
+	void SetData(const TSharedPtr<const FPickableDateTimeTimelineData>& InData);
+
+	// Zooms so that all values are visible.
+	void ZoomToFit();
+
+	// Sets whether the values are being gathered, which is shown instead of the hover information.
+	void SetIsLoading(bool bInIsLoading);
+
+	// SWidget interface.
+	virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
+	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+	virtual FReply OnMouseWheel(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+	virtual FReply OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+	virtual FReply OnMouseButtonUp(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+	virtual FReply OnMouseButtonDoubleClick(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+	virtual FReply OnMouseMove(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+	virtual void OnMouseLeave(const FPointerEvent& MouseEvent) override;
+	// End of SWidget interface.
+
+protected:
+	// SWidget interface.
+	virtual FVector2D ComputeDesiredSize(float LayoutScaleMultiplier) const override;
+	// End of SWidget interface.
+
+private:
+	// Recalculates the bars, the axis labels and the marker for today if the visible range,
+	// the size or the day has changed since the last time.
+	void UpdateBins(const FVector2f& Size) const;
+
+	// Updates the information shown at the top if the hovered bar or the state has changed since the last time.
+	void UpdateInfoText() const;
+
+	// Returns the index of the bar at the position, or INDEX_NONE.
+	int32 FindBinAt(float LocalX) const;
+
+	// Returns the position of the start of the day in the widget.
+	float DayNumberToLocalX(int64 DayNumber) const;
+
+	// Keeps the visible range within the range of FDateTime.
+	void ClampView();
+
+	// Requests a repaint after the view or the hovered bar has changed.
+	void OnViewChanged();
+
+private:
+	// The values to display.
+	TSharedPtr<const FPickableDateTimeTimelineData> Data;
+
+	// An event that is called when a bar is clicked.
+	FOnBinClicked OnBinClicked;
+
+	// The day number at the left edge of the widget.
+	double ViewFirstDayNumber = 0.;
+
+	// The zoom level.
+	double DaysPerPixel = 1.;
+
+	// The width of the widget when it was last ticked.
+	float ViewWidth = 0.f;
+
+	// Whether to zoom to fit once the width is known.
+	bool bZoomToFitPending = false;
+
+	// The state of dragging to pan.
+	bool bIsDragging = false;
+	float DragStartLocalX = 0.f;
+	double DragStartFirstDayNumber = 0.;
+
+	// The index of the bar under the mouse cursor.
+	int32 HoveredBinIndex = INDEX_NONE;
+
+	// Whether the values are being gathered.
+	bool bIsLoading = false;
+
+	// The bars calculated for the last visible range. BinEdges has one more element than BinCounts.
+	mutable TArray<int64> BinEdges;
+	mutable TArray<int32> BinCounts;
+	mutable int32 MaxBinCount = 0;
+	mutable int32 BinLevelIndex = 0;
+
+	// A label on the axis and the line drawn at its bin edge.
+	struct FAxisLabel
+	{
+		FVector2f Position;
+		FString Text;
+		TArray<FVector2f> TickPoints;
+	};
+
+	// The axis labels and the marker for today calculated for the last visible range.
+	// TodayPoints is empty when today is out of view.
+	mutable TArray<FAxisLabel> AxisLabels;
+	mutable TArray<FVector2f> TodayPoints;
+
+	// The visible range that the bars were calculated for.
+	mutable double CachedFirstDayNumber = -1.;
+	mutable double CachedDaysPerPixel = -1.;
+	mutable FVector2f CachedSize = FVector2f(-1.f);
+	mutable int64 CachedTodayDayNumber = -1;
+
+	// The information shown at the top and the hovered bar that it was made for.
+	mutable FText InfoText;
+	mutable int32 InfoBinIndex = INDEX_NONE;
+	mutable bool bInfoTextDirty = true;
+};
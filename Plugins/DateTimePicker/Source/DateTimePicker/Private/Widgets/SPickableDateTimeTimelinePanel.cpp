@@ -0,0 +1,159 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#include "Widgets/SPickableDateTimeTimelinePanel.h"
+#include "Widgets/SPickableDateTimeTimeline.h"
+#include "Timeline/PickableDateTimeTimelineData.h"
+#include "Widgets/Input/SButton.h"
+#include "Widgets/Input/SEditableTextBox.h"
+#include "Widgets/SBoxPanel.h"
+#include "Widgets/Text/STextBlock.h"
+#include "Subsystems/AssetEditorSubsystem.h"
+#include "Editor.h"
+#include "DateTimePickerGlobals.h"
+
+#define LOCTEXT_NAMESPACE "PickableDateTimeTimelinePanel"
+
+namespace PickableDateTimeTimelinePanelInternal
+{
+	// The maximum number of assets to open at once. More assets are selected in the Content Browser instead.
+	static constexpr int32 MaxAssetsToOpen = 8;
+}
+
+void SPickableDateTimeTimelinePanel::Construct(const FArguments& InArgs)
+{
+	ChildSlot
+	[
+		SNew(SVerticalBox)
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(4.f)
+		[
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			.Padding(0.f, 0.f, 4.f, 0.f)
+			[
+				SNew(STextBlock)
+				.Text(LOCTEXT("FolderLabel", "Folder"))
+			]
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.f)
+			[
+				SAssignNew(PackagePathTextBox, SEditableTextBox)
+				.Text(FText::FromString(InArgs._PackagePath))
+				.OnTextCommitted(this, &SPickableDateTimeTimelinePanel::HandleOnPackagePathCommitted)
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(4.f, 0.f)
+			[
+				SNew(SButton)
+				.Text(LOCTEXT("ScanButton", "Scan"))
+				.OnClicked(this, &SPickableDateTimeTimelinePanel::HandleOnScanClicked)
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			[
+				SNew(STextBlock)
+				.Text_Lambda([this]() { return SummaryText; })
+			]
+		]
+		+ SVerticalBox::Slot()
+		.FillHeight(1.f)
+		.Padding(4.f)
+		[
+			SAssignNew(Timeline, SPickableDateTimeTimeline)
+			.OnBinClicked(this, &SPickableDateTimeTimelinePanel::HandleOnBinClicked)
+		]
+	];
+
+	Scan();
+}
+
+void SPickableDateTimeTimelinePanel::Scan()
+{
+	FString PackagePath = PackagePathTextBox->GetText().ToString().TrimStartAndEnd();
+	while (PackagePath.Len() > 1 && PackagePath.EndsWith(TEXT("/")))
+	{
+		PackagePath.LeftChopInline(1);
+	}
+
+	const uint32 ScanId = ++LatestScanId;
+	SummaryText = FText::Format(LOCTEXT("ScanningFormat", "Scanning {0}..."), FText::FromString(PackagePath));
+	Timeline->SetIsLoading(true);
+
+	// The tab may be closed before the scan finishes.
+	TWeakPtr<SPickableDateTimeTimelinePanel> WeakThis = SharedThis(this);
+	FPickableDateTimeTimelineData::GatherAsync(
+		FName(*PackagePath),
+		true,
+		[WeakThis, ScanId, PackagePath, StartTime = FPlatformTime::Seconds()](TSharedRef<FPickableDateTimeTimelineData> GatheredData)
+		{
+			const TSharedPtr<SPickableDateTimeTimelinePanel> This = WeakThis.Pin();
+			if (This.IsValid() && This->LatestScanId == ScanId)
+			{
+				This->HandleOnGathered(GatheredData, PackagePath, StartTime);
+			}
+		}
+	);
+}
+
+void SPickableDateTimeTimelinePanel::HandleOnGathered(const TSharedRef<FPickableDateTimeTimelineData>& GatheredData, const FString& PackagePath, double StartTime)
+{
+	const double ElapsedMilliseconds = (FPlatformTime::Seconds() - StartTime) * 1000.;
+	Data = GatheredData;
+
+	SummaryText = FText::Format(
+		LOCTEXT("SummaryFormat", "{0} values in {1} assets ({2} ms)"),
+		FText::AsNumber(Data->GetNumValues()),
+		FText::AsNumber(Data->GetNumAssets()),
+		FText::AsNumber(FMath::RoundToInt(ElapsedMilliseconds))
+	);
+	UE_LOG(LogDateTimePicker, Log, TEXT("Scanned %s: %s"), *PackagePath, *SummaryText.ToString());
+
+	Timeline->SetData(Data);
+	Timeline->SetIsLoading(false);
+}
+
+FReply SPickableDateTimeTimelinePanel::HandleOnScanClicked()
+{
+	Scan();
+	return FReply::Handled();
+}
+
+void SPickableDateTimeTimelinePanel::HandleOnPackagePathCommitted(const FText& NewText, ETextCommit::Type CommitType)
+{
+	if (CommitType == ETextCommit::OnEnter)
+	{
+		Scan();
+	}
+}
+
+void SPickableDateTimeTimelinePanel::HandleOnBinClicked(int64 FirstDayNumber, int64 EndDayNumber)
+{
+	if (!Data.IsValid() || GEditor == nullptr)
+	{
+		return;
+	}
+
+	TArray<FAssetData> Assets;
+	Data->GetAssetsInRange(FirstDayNumber, EndDayNumber, Assets);
+	if (Assets.Num() > PickableDateTimeTimelinePanelInternal::MaxAssetsToOpen)
+	{
+		GEditor->SyncBrowserToObjects(Assets);
+		return;
+	}
+
+	UAssetEditorSubsystem* AssetEditorSubsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>();
+	for (const FAssetData& AssetData : Assets)
+	{
+		if (UObject* Asset = AssetData.GetAsset())
+		{
+			AssetEditorSubsystem->OpenEditorForAsset(Asset);
+		}
+	}
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,61 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+
+class SEditableTextBox;
+class SPickableDateTimeTimeline;
+class FPickableDateTimeTimelineData;
+
+/**
+ * Widget that scans the assets in a folder and shows their FPickableDateTime values on a timeline.
+ * Clicking a bar opens the assets that have values in it, or selects them in the Content Browser if there are many.
+ */
+class DATETIMEPICKER_API SPickableDateTimeTimelinePanel : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SPickableDateTimeTimelinePanel)
+		: _PackagePath(TEXT("/Game"))
+	{}
+
+	// The folder to scan first.
+	SLATE_ARGUMENT(FString, PackagePath)
+
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+private:
+	// Starts scanning the folder entered in the text box.
+	void Scan();
+
+	// Called on the game thread when a scan has finished.
+	void HandleOnGathered(const TSharedRef<FPickableDateTimeTimelineData>& GatheredData, const FString& PackagePath, double StartTime);
+
+	// Called when the scan button is pressed.
+	FReply HandleOnScanClicked();
+
+	// Called when the folder is committed in the text box, scans it when Enter is pressed.
+	void HandleOnPackagePathCommitted(const FText& NewText, ETextCommit::Type CommitType);
+
+	// Called when a bar of the timeline is clicked.
+	void HandleOnBinClicked(int64 FirstDayNumber, int64 EndDayNumber);
+
+private:
+	// A text box to enter the folder to scan.
+	TSharedPtr<SEditableTextBox> PackagePathTextBox;
+
+	// The timeline that displays the values.
+	TSharedPtr<SPickableDateTimeTimeline> Timeline;
+
+	// The values found by the last scan.
+	TSharedPtr<const FPickableDateTimeTimelineData> Data;
+
+	// The result of the last scan.
+	FText SummaryText;
+
+	// Incremented for each scan so that results of a superseded scan are discarded.
+	uint32 LatestScanId = 0;
+};
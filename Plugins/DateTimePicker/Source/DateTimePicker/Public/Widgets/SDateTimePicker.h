@@ -0,0 +1,192 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+#include "PickableDateTimeConstraints.h"
+#include "PickableDateTimeCalendarDescriptor.h"
+
+class SUniformGridPanel;
+class SEditableTextBox;
+
+/**
+ * Widget that displays the calendar and lets you select the date and time.
+ */
+class DATETIMEPICKER_API SDateTimePicker : public SCompoundWidget
+{
+public:
+	// Defines an event to be called when a date and time is selected in the DateTimePicker.
+	DECLARE_DELEGATE_OneParam(FOnDateTimePicked, const FDateTime&);
+
+	// Defines the mode type of DateTimePicker.
+	enum class EDateTimePickerMode : uint8
+	{
+		Year,
+		Month,
+		Day,
+		Hour,
+		Minute,
+		Second,
+		Millisecond,
+	};
+	
+public:
+	SLATE_BEGIN_ARGS(SDateTimePicker)
+		: _InitialSelection(nullptr)
+		, _LivePreviewInterval(0.1f)
+		, _ShowWeekNumbers(false)
+	{}
+
+	// Specifies the item that should be selected first.
+	SLATE_ARGUMENT(TSharedPtr<FDateTime>, InitialSelection)
+
+	// Constraints on the dates that can be selected.
+	SLATE_ARGUMENT(FPickableDateTimeConstraints, Constraints)
+
+	// Called when a date and time is selected by the DateTimePicker.
+	SLATE_EVENT(FOnDateTimePicked, OnDateTimePicked)
+
+	// Called while the user navigates the calendar. If not bound, there is no live preview.
+	SLATE_EVENT(FOnDateTimePicked, OnDateTimePreviewed)
+
+	// Called when the user cancels the selection. If not bound, OnDateTimePicked is called with the initial selection.
+	SLATE_EVENT(FSimpleDelegate, OnCanceled)
+
+	// The minimum number of seconds between OnDateTimePreviewed calls.
+	SLATE_ARGUMENT(float, LivePreviewInterval)
+
+	// The day of the week that the calendar starts on. If not set, it depends on the current culture.
+	SLATE_ARGUMENT(TOptional<EDayOfWeek>, FirstDayOfWeek)
+
+	// Whether to show the ISO week numbers in the day mode.
+	SLATE_ARGUMENT(bool, ShowWeekNumbers)
+	
+	SLATE_END_ARGS()
+
+	void OnPressedPreviousMonth();
+	void OnPressedNextMonth();
+	void OnPressedNow();
+	void OnYearChanged();
+	void OnPressedOkay();
+	void OnPressedCancel();
+
+	void Construct(const FArguments& InArgs);
+
+	// Resets the state so that the same widget can be reused for another property.
+	void Retarget(const FArguments& InArgs);
+
+private:
+	// Rebuild the date and time on the calendar.
+	void RebuildCalenderPanel();
+
+	// Gets the date and time currently selected, which the grids highlight.
+	FDateTime GetPendingDateTime() const;
+
+	// Gets the year and month text to display as the calendar title.
+	FText GetTitleText() const;
+
+	// Gets the text of the button that switches to the year mode.
+	FText GetYearText() const;
+
+	// Gets the width of the widget, which is wider when the week numbers are shown.
+	FOptionalSize GetDesiredWidth() const;
+
+	// Called when a structure is selected from the list.
+	void HandleOnDateTimePicked(const FDateTime& PickedDateTime);
+
+	// Called when the text of the quick entry is changed, previews the result on the calendar.
+	void HandleOnQuickEntryTextChanged(const FText& NewText);
+
+	// Called when the text of the quick entry is committed, picks the result when Enter is pressed.
+	void HandleOnQuickEntryTextCommitted(const FText& NewText, ETextCommit::Type CommitType);
+
+	// Notifies the pending date and time for live preview, no more often than LivePreviewInterval.
+	void NotifyPreview();
+
+	// Called when the throttled live preview is due.
+	EActiveTimerReturnType HandleOnPreviewTimer(double InCurrentTime, float InDeltaTime);
+
+	// Cancels the live preview that has not been notified yet.
+	void CancelPendingPreview();
+	
+private:
+	// The inputs that decide the grids of the calendar panel.
+	struct FCalendarPanelState
+	{
+		EDateTimePickerMode Mode;
+		FDateTime FirstDate;
+		FDateTime Today;
+		EDayOfWeek FirstDayOfWeek;
+		uint64 GrayOutMask;
+		uint64 DisabledMask;
+		bool bWeekNumberColumn;
+		const FPickableDateTimeCalendarDescriptor* CalendarDescriptor;
+
+		bool operator==(const FCalendarPanelState& Other) const
+		{
+			return Mode == Other.Mode
+				&& FirstDate == Other.FirstDate
+				&& Today == Other.Today
+				&& FirstDayOfWeek == Other.FirstDayOfWeek
+				&& GrayOutMask == Other.GrayOutMask
+				&& DisabledMask == Other.DisabledMask
+				&& bWeekNumberColumn == Other.bWeekNumberColumn
+				&& CalendarDescriptor == Other.CalendarDescriptor;
+		}
+	};
+
+	// Current DateTimePicker mode.
+	EDateTimePickerMode Mode = EDateTimePickerMode::Day;
+
+	// Culture dependent names and settings shared by all pickers.
+	TSharedPtr<const FPickableDateTimeCalendarDescriptor> CalendarDescriptor;
+
+	// The day of the week that the calendar starts on, overriding the culture.
+	TOptional<EDayOfWeek> FirstDayOfWeekOverride;
+
+	// Whether to show the ISO week numbers in the day mode.
+	bool bShowWeekNumbers = false;
+
+	// The title and year texts, and the month and culture they were formatted for.
+	FText CachedTitleText;
+	FText CachedYearText;
+	int32 CachedTitleYearMonth = INDEX_NONE;
+	const FPickableDateTimeCalendarDescriptor* CachedTitleDescriptor = nullptr;
+	
+	// Constraints on the dates that can be selected.
+	FPickableDateTimeConstraints Constraints;
+
+	// Currently selected DateTime.
+	FDateTime PendingDateTime;
+
+	// Selected DataTime once open the Calendar
+	FDateTime InitialDateTimeSelected;
+
+	// A grid panel that displays the date and time of the calendar.
+	TSharedPtr<SUniformGridPanel> CalendarPanel;
+
+	// The state the calendar panel was last built for. Not set if it has not been built yet.
+	TOptional<FCalendarPanelState> BuiltPanelState;
+
+	// A text box to enter relative or absolute dates.
+	TSharedPtr<SEditableTextBox> QuickEntryTextBox;
+	
+	// An event that is called when a date and time is selected by the DateTimePicker.
+	FOnDateTimePicked OnDateTimePicked;
+
+	// An event that is called while the user navigates the calendar.
+	FOnDateTimePicked OnDateTimePreviewed;
+
+	// An event that is called when the user cancels the selection.
+	FSimpleDelegate OnCanceled;
+
+	// The minimum number of seconds between live preview notifications.
+	float LivePreviewInterval = 0.f;
+
+	// The time when the live preview was last notified.
+	double LastPreviewTime = 0.;
+
+	// The timer that notifies the throttled live preview.
+	TWeakPtr<FActiveTimerHandle> PreviewTimerHandle;
+};
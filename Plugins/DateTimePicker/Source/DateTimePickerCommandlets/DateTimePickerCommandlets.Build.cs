@@ -0,0 +1,37 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+using UnrealBuildTool;
+
+public class DateTimePickerCommandlets : ModuleRules
+{
+	public DateTimePickerCommandlets(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+	
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+			}
+			);
+		
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"CoreUObject",
+				"Engine",
+				"AssetRegistry",
+				"Json",
+				"Slate",
+				"SlateCore",
+				
+				"PickableDateTime",
+				"DateTimePicker",
+			}
+			);
+		
+		// The benchmarks commandlet creates a Slate application without a renderer to run the picker benchmarks headless.
+		PrivateIncludePathModuleNames.Add("SlateNullRenderer");
+		DynamicallyLoadedModuleNames.Add("SlateNullRenderer");
+	}
+}
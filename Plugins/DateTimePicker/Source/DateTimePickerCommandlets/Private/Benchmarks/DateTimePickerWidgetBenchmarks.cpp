@@ -0,0 +1,83 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#include "Benchmarks/DateTimePickerWidgetBenchmarks.h"
+#include "Widgets/SDateTimePicker.h"
+#include "PickableDateTimeBenchmark.h"
+#include "HAL/IConsoleManager.h"
+
+namespace DateTimePickerWidgetBenchmarksInternal
+{
+	// The names of the benchmarks registered by this module.
+	static const TCHAR* PickerConstructName = TEXT("Picker.Construct");
+	static const TCHAR* PickerRebuildName = TEXT("Picker.Rebuild");
+
+	// The registered console command.
+	static IConsoleObject* RunBenchmarksCommand = nullptr;
+
+	// Returns the selection of the iteration, moving through the months so that every rebuild lays out a different grid.
+	static TSharedPtr<FDateTime> MakeSelection(int64 Iteration)
+	{
+		return MakeShared<FDateTime>(FDateTime(2000, 1, 15) + FTimespan::FromDays(static_cast<double>((Iteration % 1200) * 31)));
+	}
+}
+
+void FDateTimePickerWidgetBenchmarks::Register()
+{
+	using namespace DateTimePickerWidgetBenchmarksInternal;
+
+	// Constructing the whole widget, which is what opening the picker from a property pays.
+	FPickableDateTimeBenchmark::Register(PickerConstructName, [](int64 NumIterations) -> uint64
+	{
+		uint64 Checksum = 0;
+		for (int64 Iteration = 0; Iteration < NumIterations; Iteration++)
+		{
+			const TSharedRef<SDateTimePicker> Picker = SNew(SDateTimePicker)
+				.InitialSelection(MakeSelection(Iteration));
+			Checksum += Picker->GetAllChildren()->Num();
+		}
+		return Checksum;
+	});
+
+	// Retargeting an existing widget, which rebuilds the calendar panel as navigating between months does.
+	FPickableDateTimeBenchmark::Register(PickerRebuildName, [](int64 NumIterations) -> uint64
+	{
+		const TSharedRef<SDateTimePicker> Picker = SNew(SDateTimePicker);
+
+		uint64 Checksum = 0;
+		for (int64 Iteration = 0; Iteration < NumIterations; Iteration++)
+		{
+			Picker->Retarget(SDateTimePicker::FArguments()
+				.InitialSelection(MakeSelection(Iteration))
+				.ShowWeekNumbers((Iteration & 1) != 0)
+			);
+			Checksum += Picker->GetAllChildren()->Num();
+		}
+		return Checksum;
+	});
+
+	RunBenchmarksCommand = IConsoleManager::Get().RegisterConsoleCommand(
+		TEXT("DateTimePicker.RunBenchmarks"),
+		TEXT("Runs the date time benchmarks and writes the results to JSON. Takes the arguments of the DateTimePickerBenchmarks commandlet."),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&FDateTimePickerWidgetBenchmarks::HandleRunBenchmarks)
+	);
+}
+
+void FDateTimePickerWidgetBenchmarks::Unregister()
+{
+	using namespace DateTimePickerWidgetBenchmarksInternal;
+
+	if (RunBenchmarksCommand != nullptr)
+	{
+		IConsoleManager::Get().UnregisterConsoleObject(RunBenchmarksCommand);
+		RunBenchmarksCommand = nullptr;
+	}
+
+	FPickableDateTimeBenchmark::Unregister(PickerConstructName);
+	FPickableDateTimeBenchmark::Unregister(PickerRebuildName);
+}
+
+void FDateTimePickerWidgetBenchmarks::HandleRunBenchmarks(const TArray<FString>& Args)
+{
+	const FString Params = FString::Join(Args, TEXT(" "));
+	FPickableDateTimeBenchmark::RunAndSave(FPickableDateTimeBenchmarkSettings::FromParams(*Params));
+}
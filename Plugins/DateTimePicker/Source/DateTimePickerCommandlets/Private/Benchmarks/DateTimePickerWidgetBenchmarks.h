@@ -0,0 +1,22 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Registers the benchmarks that need Slate, such as rebuilding the picker, and the DateTimePicker.RunBenchmarks
+ * console command that runs them together with the benchmarks of the runtime types in a running editor.
+ * The DateTimePickerBenchmarks commandlet runs them too, on a Slate application that renders nothing.
+ */
+class FDateTimePickerWidgetBenchmarks
+{
+public:
+	// Register-Unregister the benchmarks and the console command.
+	static void Register();
+	static void Unregister();
+
+private:
+	// Called when the console command is executed.
+	static void HandleRunBenchmarks(const TArray<FString>& Args);
+};
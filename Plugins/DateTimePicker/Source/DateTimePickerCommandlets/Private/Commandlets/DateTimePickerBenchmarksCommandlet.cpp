@@ -0,0 +1,37 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#include "Commandlets/DateTimePickerBenchmarksCommandlet.h"
+#include "PickableDateTimeBenchmark.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Interfaces/ISlateNullRendererModule.h"
+#include "Modules/ModuleManager.h"
+
+UDateTimePickerBenchmarksCommandlet::UDateTimePickerBenchmarksCommandlet()
+{
+	IsClient = false;
+	IsEditor = false;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UDateTimePickerBenchmarksCommandlet::Main(const FString& Params)
+{
+	// Commandlets don't create a Slate application, so create one that renders nothing for the picker benchmarks.
+	// Widgets are only constructed and rebuilt, never painted, so no RHI is needed.
+	const bool bInitializeSlate = !FSlateApplication::IsInitialized();
+	if (bInitializeSlate)
+	{
+		ISlateNullRendererModule& NullRendererModule = FModuleManager::LoadModuleChecked<ISlateNullRendererModule>(TEXT("SlateNullRenderer"));
+		FSlateApplication::InitializeAsStandaloneApplication(NullRendererModule.CreateSlateNullRenderer());
+	}
+
+	const FPickableDateTimeBenchmarkSettings Settings = FPickableDateTimeBenchmarkSettings::FromParams(*Params);
+	const bool bSucceeded = FPickableDateTimeBenchmark::RunAndSave(Settings);
+
+	if (bInitializeSlate)
+	{
+		FSlateApplication::Shutdown();
+	}
+
+	return bSucceeded ? 0 : 1;
+}
@@ -0,0 +1,29 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "DateTimePickerBenchmarksCommandlet.generated.h"
+
+/**
+ * Commandlet that runs the registered microbenchmarks with warmup and repetitions, and writes the percentiles to JSON
+ * so that runs on different commits can be compared. -HardwareCounters also reads the CPU counters on Linux.
+ * The picker benchmarks (Picker.Construct and Picker.Rebuild) run on a Slate application without a renderer, so the whole
+ * set runs headless, e.g. on a Linux build machine.
+ * Usage: UnrealEditor-Cmd <Project> -run=DateTimePickerBenchmarks [-Filter=Format.] [-Warmup=3] [-Repetitions=20]
+ *        [-MinTime=0.01] [-HardwareCounters] [-Label=<commit>] [-Output=<path.json>]
+ */
+UCLASS()
+class UDateTimePickerBenchmarksCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	// Constructor.
+	UDateTimePickerBenchmarksCommandlet();
+
+	// UCommandlet interface.
+	virtual int32 Main(const FString& Params) override;
+	// End of UCommandlet interface.
+};
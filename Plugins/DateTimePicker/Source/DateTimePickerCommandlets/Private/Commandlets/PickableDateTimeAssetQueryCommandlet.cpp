@@ -0,0 +1,75 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#include "Commandlets/PickableDateTimeAssetQueryCommandlet.h"
+#include "PickableDateTimeAssetIndex.h"
+#include "PickableDateTimeQuickEntry.h"
+#include "PickableDateTimeGlobals.h"
+#include "AssetRegistry/IAssetRegistry.h"
+
+UPickableDateTimeAssetQueryCommandlet::UPickableDateTimeAssetQueryCommandlet()
+{
+	IsClient = false;
+	IsEditor = false;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UPickableDateTimeAssetQueryCommandlet::Main(const FString& Params)
+{
+	FString FromText = TEXT("sow");
+	FString ToText = TEXT("eow");
+	FString PropertyPath;
+	int32 Limit = 100;
+	FParse::Value(*Params, TEXT("From="), FromText);
+	FParse::Value(*Params, TEXT("To="), ToText);
+	FParse::Value(*Params, TEXT("Property="), PropertyPath);
+	FParse::Value(*Params, TEXT("Limit="), Limit);
+
+	const FDateTime Now = FDateTime::Now();
+	FDateTime From;
+	FDateTime To;
+	if (!FPickableDateTimeQuickEntry::Evaluate(FromText, Now, From) || !FPickableDateTimeQuickEntry::Evaluate(ToText, Now, To))
+	{
+		UE_LOG(LogPickableDateTime, Error, TEXT("Failed to evaluate the range \"%s\" to \"%s\"."), *FromText, *ToText);
+		return 1;
+	}
+
+	// Cover both days entirely.
+	From = From.GetDate();
+	To = To.GetDate() + FTimespan(ETimespan::TicksPerDay - 1);
+
+	const double ScanStartTime = FPlatformTime::Seconds();
+	IAssetRegistry::GetChecked().SearchAllAssets(true);
+	const double ScanSeconds = FPlatformTime::Seconds() - ScanStartTime;
+
+	const double BuildStartTime = FPlatformTime::Seconds();
+	const FPickableDateTimeAssetIndex& AssetIndex = FPickableDateTimeAssetIndex::Get();
+	const double BuildSeconds = FPlatformTime::Seconds() - BuildStartTime;
+
+	const FName TagName = PropertyPath.IsEmpty() ? NAME_None : FPickableDateTimeAssetTags::MakeTagName(PropertyPath);
+	const double QueryStartTime = FPlatformTime::Seconds();
+	TArray<FPickableDateTimeAssetIndex::FResult> Results;
+	AssetIndex.QueryRange(From, To, Results, TagName);
+	const double QuerySeconds = FPlatformTime::Seconds() - QueryStartTime;
+
+	UE_LOG(LogPickableDateTime, Display, TEXT("Asset Registry scan %.1f ms, index build %.1f ms (%d values in %d assets), query %.3f ms."),
+		ScanSeconds * 1000.,
+		BuildSeconds * 1000.,
+		AssetIndex.GetNumValues(),
+		AssetIndex.GetNumAssets(),
+		QuerySeconds * 1000.
+	);
+	UE_LOG(LogPickableDateTime, Display, TEXT("%d values from %s to %s:"), Results.Num(), *From.ToString(), *To.ToString());
+
+	for (int32 ResultIndex = 0; ResultIndex < FMath::Min(Results.Num(), Limit); ResultIndex++)
+	{
+		const FPickableDateTimeAssetIndex::FResult& Result = Results[ResultIndex];
+		UE_LOG(LogPickableDateTime, Display, TEXT("  %s  %s  %s"), *Result.DateTime.ToIso8601(), *Result.TagName.ToString(), *Result.AssetPath.ToString());
+	}
+	if (Results.Num() > Limit)
+	{
+		UE_LOG(LogPickableDateTime, Display, TEXT("  ... and %d more."), Results.Num() - Limit);
+	}
+
+	return 0;
+}
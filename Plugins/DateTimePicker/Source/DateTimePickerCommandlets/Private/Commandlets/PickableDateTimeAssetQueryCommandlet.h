@@ -0,0 +1,26 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "PickableDateTimeAssetQueryCommandlet.generated.h"
+
+/**
+ * Commandlet that lists the assets whose FPickableDateTime values fall in a range of days, using the asset index.
+ * From and To accept quick entry expressions relative to now, and the range covers both days entirely.
+ * Usage: UnrealEditor-Cmd <Project> -run=PickableDateTimeAssetQuery [-From="sow +1w"] [-To="eow +1w"] [-Property=Schedule.Start] [-Limit=100]
+ */
+UCLASS()
+class UPickableDateTimeAssetQueryCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	// Constructor.
+	UPickableDateTimeAssetQueryCommandlet();
+
+	// UCommandlet interface.
+	virtual int32 Main(const FString& Params) override;
+	// End of UCommandlet interface.
+};
@@ -0,0 +1,159 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#include "Commandlets/PickableDateTimeCalendarBenchmarkCommandlet.h"
+#include "PickableDateTimeCalendar.h"
+#include "PickableDateTimeGlobals.h"
+#include "Async/ParallelFor.h"
+
+namespace PickableDateTimeCalendarBenchmarkInternal
+{
+	// The number of iterations processed by a single ParallelFor task.
+	static constexpr int32 ChunkSize = 65536;
+
+	// The day number of January 1, 2000, the first day of the benchmarked range.
+	static constexpr int64 FirstDayNumber = PickableDateTimeCalendar::DaysFromCivil(2000, 1, 1);
+
+	// A calculation to measure, returning a value that is summed into the checksum.
+	struct FCase
+	{
+		const TCHAR* Name;
+		int64 (*Calculate)(int64 DayNumber, int32 Iteration);
+	};
+
+	static const FCase Cases[] =
+	{
+		{
+			TEXT("CivilFromDays"),
+			[](int64 DayNumber, int32 Iteration) -> int64
+			{
+				int32 Year = 0, Month = 0, Day = 0;
+				PickableDateTimeCalendar::CivilFromDays(DayNumber, Year, Month, Day);
+				return Year + Month + Day;
+			}
+		},
+		{
+			TEXT("FDateTime::GetDate"),
+			[](int64 DayNumber, int32 Iteration) -> int64
+			{
+				int32 Year = 0, Month = 0, Day = 0;
+				PickableDateTimeCalendar::FromDayNumber(DayNumber).GetDate(Year, Month, Day);
+				return Year + Month + Day;
+			}
+		},
+		{
+			TEXT("AddMonths"),
+			[](int64 DayNumber, int32 Iteration) -> int64
+			{
+				return PickableDateTimeCalendar::AddMonths(DayNumber, (Iteration % 25) - 12);
+			}
+		},
+		{
+			TEXT("StartOfWeek"),
+			[](int64 DayNumber, int32 Iteration) -> int64
+			{
+				return PickableDateTimeCalendar::StartOfWeek(DayNumber, Iteration % 7);
+			}
+		},
+		{
+			TEXT("StartOfQuarter"),
+			[](int64 DayNumber, int32 Iteration) -> int64
+			{
+				return PickableDateTimeCalendar::StartOfQuarter(DayNumber);
+			}
+		},
+		{
+			TEXT("GetIsoWeek"),
+			[](int64 DayNumber, int32 Iteration) -> int64
+			{
+				int32 WeekYear = 0;
+				return PickableDateTimeCalendar::GetIsoWeek(DayNumber, WeekYear) + WeekYear;
+			}
+		},
+		{
+			TEXT("AddBusinessDays"),
+			[](int64 DayNumber, int32 Iteration) -> int64
+			{
+				return PickableDateTimeCalendar::AddBusinessDays(DayNumber, (Iteration % 61) - 30);
+			}
+		},
+	};
+
+	// Runs the case over the iterations in chunks and returns the checksum.
+	static int64 Run(const FCase& Case, int32 NumIterations, bool bParallel)
+	{
+		const int32 NumChunks = FMath::DivideAndRoundUp(NumIterations, ChunkSize);
+		TArray<int64> ChunkChecksums;
+		ChunkChecksums.SetNumZeroed(NumChunks);
+
+		ParallelFor(NumChunks, [&](int32 ChunkIndex)
+		{
+			const int32 FirstIteration = ChunkIndex * ChunkSize;
+			const int32 LastIteration = FMath::Min(FirstIteration + ChunkSize, NumIterations);
+
+			int64 Checksum = 0;
+			for (int32 Iteration = FirstIteration; Iteration < LastIteration; Iteration++)
+			{
+				// Cover about 100 years so that every month and leap year rule is exercised.
+				Checksum += Case.Calculate(FirstDayNumber + (Iteration % 36524), Iteration);
+			}
+			ChunkChecksums[ChunkIndex] = Checksum;
+		}, bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+
+		int64 Checksum = 0;
+		for (const int64 ChunkChecksum : ChunkChecksums)
+		{
+			Checksum += ChunkChecksum;
+		}
+
+		return Checksum;
+	}
+}
+
+UPickableDateTimeCalendarBenchmarkCommandlet::UPickableDateTimeCalendarBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsEditor = false;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UPickableDateTimeCalendarBenchmarkCommandlet::Main(const FString& Params)
+{
+	using namespace PickableDateTimeCalendarBenchmarkInternal;
+
+	int32 NumIterations = 10000000;
+	FParse::Value(*Params, TEXT("Iterations="), NumIterations);
+	NumIterations = FMath::Max(NumIterations, 1);
+
+	UE_LOG(LogPickableDateTime, Display, TEXT("Running calendar calculations %d times each on %d worker threads."),
+		NumIterations,
+		FTaskGraphInterface::Get().GetNumWorkerThreads()
+	);
+
+	for (const FCase& Case : Cases)
+	{
+		const double SingleStartTime = FPlatformTime::Seconds();
+		const int64 SingleChecksum = Run(Case, NumIterations, false);
+		const double SingleSeconds = FPlatformTime::Seconds() - SingleStartTime;
+
+		const double ParallelStartTime = FPlatformTime::Seconds();
+		const int64 ParallelChecksum = Run(Case, NumIterations, true);
+		const double ParallelSeconds = FPlatformTime::Seconds() - ParallelStartTime;
+
+		// The calculations are pure, so running them on workers must not change the result.
+		if (SingleChecksum != ParallelChecksum)
+		{
+			UE_LOG(LogPickableDateTime, Error, TEXT("%s returned different results on worker threads."), Case.Name);
+			return 1;
+		}
+
+		UE_LOG(LogPickableDateTime, Display, TEXT("%-20s single %8.2f ns/op, parallel %8.2f Mops/s (checksum %lld)"),
+			Case.Name,
+			(SingleSeconds * 1e9) / NumIterations,
+			(NumIterations / FMath::Max(ParallelSeconds, UE_SMALL_NUMBER)) / 1e6,
+			SingleChecksum
+		);
+	}
+
+	return 0;
+}
@@ -0,0 +1,25 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "PickableDateTimeCalendarBenchmarkCommandlet.generated.h"
+
+/**
+ * Commandlet that measures the single-threaded and ParallelFor throughput of the calendar calculations.
+ * Usage: UnrealEditor-Cmd <Project> -run=PickableDateTimeCalendarBenchmark [-Iterations=10000000]
+ */
+UCLASS()
+class UPickableDateTimeCalendarBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	// Constructor.
+	UPickableDateTimeCalendarBenchmarkCommandlet();
+
+	// UCommandlet interface.
+	virtual int32 Main(const FString& Params) override;
+	// End of UCommandlet interface.
+};
@@ -0,0 +1,119 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#include "Commandlets/PickableDateTimeHashBenchmarkCommandlet.h"
+#include "PickableDateTime.h"
+#include "PickableDateTimeFlatMap.h"
+#include "PickableDateTimeQuantizedKey.h"
+#include "PickableDateTimeGlobals.h"
+#include "Math/RandomStream.h"
+
+namespace PickableDateTimeHashBenchmarkInternal
+{
+	// Logs the result of a benchmark.
+	static void ReportResult(const TCHAR* Name, int32 NumEntries, double InsertSeconds, double LookupSeconds, SIZE_T AllocatedSize, int64 Checksum)
+	{
+		UE_LOG(LogPickableDateTime, Display, TEXT("%-40s insert %8.2f ns/op, lookup %8.2f ns/op, %8.2f MiB (checksum %lld)"),
+			Name,
+			(InsertSeconds * 1e9) / NumEntries,
+			(LookupSeconds * 1e9) / NumEntries,
+			AllocatedSize / (1024. * 1024.),
+			Checksum
+		);
+	}
+
+	// Measures a TMap with the specified key type.
+	template<typename KeyType>
+	static void RunMapBenchmark(const TCHAR* Name, const TArray<FDateTime>& DateTimes, const TArray<FDateTime>& LookupOrder)
+	{
+		TMap<KeyType, int32> Map;
+
+		const double InsertStartTime = FPlatformTime::Seconds();
+		for (int32 Index = 0; Index < DateTimes.Num(); Index++)
+		{
+			Map.Add(KeyType(DateTimes[Index]), Index);
+		}
+		const double InsertSeconds = FPlatformTime::Seconds() - InsertStartTime;
+
+		int64 Checksum = 0;
+		const double LookupStartTime = FPlatformTime::Seconds();
+		for (const FDateTime& DateTime : LookupOrder)
+		{
+			if (const int32* Value = Map.Find(KeyType(DateTime)))
+			{
+				Checksum += *Value;
+			}
+		}
+		const double LookupSeconds = FPlatformTime::Seconds() - LookupStartTime;
+
+		ReportResult(Name, DateTimes.Num(), InsertSeconds, LookupSeconds, Map.GetAllocatedSize(), Checksum);
+	}
+
+	// Measures TPickableDateTimeFlatMap.
+	static void RunFlatMapBenchmark(const TCHAR* Name, const TArray<FDateTime>& DateTimes, const TArray<FDateTime>& LookupOrder)
+	{
+		TPickableDateTimeFlatMap<int32> Map;
+
+		const double InsertStartTime = FPlatformTime::Seconds();
+		for (int32 Index = 0; Index < DateTimes.Num(); Index++)
+		{
+			Map.Add(DateTimes[Index], Index);
+		}
+		const double InsertSeconds = FPlatformTime::Seconds() - InsertStartTime;
+
+		int64 Checksum = 0;
+		const double LookupStartTime = FPlatformTime::Seconds();
+		for (const FDateTime& DateTime : LookupOrder)
+		{
+			if (const int32* Value = Map.Find(DateTime))
+			{
+				Checksum += *Value;
+			}
+		}
+		const double LookupSeconds = FPlatformTime::Seconds() - LookupStartTime;
+
+		ReportResult(Name, DateTimes.Num(), InsertSeconds, LookupSeconds, Map.GetAllocatedSize(), Checksum);
+	}
+}
+
+UPickableDateTimeHashBenchmarkCommandlet::UPickableDateTimeHashBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsEditor = false;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UPickableDateTimeHashBenchmarkCommandlet::Main(const FString& Params)
+{
+	using namespace PickableDateTimeHashBenchmarkInternal;
+
+	int32 NumEntries = 1000000;
+	FParse::Value(*Params, TEXT("Entries="), NumEntries);
+	NumEntries = FMath::Max(NumEntries, 1);
+
+	// Per-second telemetry timestamps, which only differ in the lower bits of the ticks.
+	const FDateTime StartDateTime(2024, 1, 1);
+	TArray<FDateTime> DateTimes;
+	DateTimes.Reserve(NumEntries);
+	for (int32 Index = 0; Index < NumEntries; Index++)
+	{
+		DateTimes.Add(StartDateTime + FTimespan::FromSeconds(Index));
+	}
+
+	TArray<FDateTime> LookupOrder = DateTimes;
+	FRandomStream RandomStream(0);
+	for (int32 Index = LookupOrder.Num() - 1; Index > 0; Index--)
+	{
+		LookupOrder.Swap(Index, RandomStream.RandRange(0, Index));
+	}
+
+	UE_LOG(LogPickableDateTime, Display, TEXT("Benchmarking maps with %d per-second keys."), NumEntries);
+
+	// FDateTime still uses the hash that FPickableDateTime used to forward to.
+	RunMapBenchmark<FDateTime>(TEXT("TMap<FDateTime> (previous hash)"), DateTimes, LookupOrder);
+	RunMapBenchmark<FPickableDateTime>(TEXT("TMap<FPickableDateTime>"), DateTimes, LookupOrder);
+	RunMapBenchmark<FPickableDateTimePerSecond>(TEXT("TMap<FPickableDateTimePerSecond>"), DateTimes, LookupOrder);
+	RunFlatMapBenchmark(TEXT("TPickableDateTimeFlatMap"), DateTimes, LookupOrder);
+
+	return 0;
+}
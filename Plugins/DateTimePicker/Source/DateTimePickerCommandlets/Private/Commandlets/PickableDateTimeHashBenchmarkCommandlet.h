@@ -0,0 +1,25 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "PickableDateTimeHashBenchmarkCommandlet.generated.h"
+
+/**
+ * Commandlet that compares insertion, lookup and memory of maps keyed by date and time.
+ * Usage: UnrealEditor-Cmd <Project> -run=PickableDateTimeHashBenchmark [-Entries=1000000]
+ */
+UCLASS()
+class UPickableDateTimeHashBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	// Constructor.
+	UPickableDateTimeHashBenchmarkCommandlet();
+
+	// UCommandlet interface.
+	virtual int32 Main(const FString& Params) override;
+	// End of UCommandlet interface.
+};
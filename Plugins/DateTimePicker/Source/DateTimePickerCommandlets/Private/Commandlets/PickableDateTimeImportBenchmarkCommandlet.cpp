@@ -0,0 +1,118 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#include "Commandlets/PickableDateTimeImportBenchmarkCommandlet.h"
+#include "PickableDateTime.h"
+#include "PickableDateTimeImport.h"
+#include "PickableDateTimeGlobals.h"
+#include "Math/RandomStream.h"
+#include "Misc/OutputDeviceNull.h"
+
+namespace PickableDateTimeImportBenchmarkInternal
+{
+	// Logs the result of a benchmark.
+	static void ReportResult(const TCHAR* Name, int32 NumRows, double Seconds, int32 NumErrors)
+	{
+		const double RowsPerSecond = (Seconds > 0.) ? (NumRows / Seconds) : 0.;
+		UE_LOG(LogPickableDateTime, Display, TEXT("%-40s %10.0f rows/sec (%.3f sec, %d errors)"), Name, RowsPerSecond, Seconds, NumErrors);
+	}
+
+	// Imports each text through UScriptStruct::ImportText on a single thread.
+	static int32 ImportWithScriptStruct(const TArray<FString>& Texts, TArray<FPickableDateTime>& Values, bool bAllowNativeOverride)
+	{
+		UScriptStruct* Struct = FPickableDateTime::StaticStruct();
+		const FString StructName = Struct->GetName();
+		FOutputDeviceNull NullOutput;
+
+		int32 NumErrors = 0;
+		for (int32 RowIndex = 0; RowIndex < Texts.Num(); RowIndex++)
+		{
+			if (Struct->ImportText(*Texts[RowIndex], &Values[RowIndex], nullptr, PPF_None, &NullOutput, StructName, bAllowNativeOverride) == nullptr)
+			{
+				NumErrors++;
+			}
+		}
+
+		return NumErrors;
+	}
+}
+
+UPickableDateTimeImportBenchmarkCommandlet::UPickableDateTimeImportBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsEditor = false;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UPickableDateTimeImportBenchmarkCommandlet::Main(const FString& Params)
+{
+	using namespace PickableDateTimeImportBenchmarkInternal;
+
+	int32 NumRows = 500000;
+	int32 Seed = 0;
+	FParse::Value(*Params, TEXT("Rows="), NumRows);
+	FParse::Value(*Params, TEXT("Seed="), Seed);
+	NumRows = FMath::Max(NumRows, 1);
+
+	// Generate the same date and times in each of the supported formats.
+	const int64 MinTicks = FDateTime(2000, 1, 1).GetTicks();
+	const int64 MaxTicks = FDateTime(2050, 1, 1).GetTicks();
+	FRandomStream RandomStream(Seed);
+
+	TArray<FString> StructTexts;
+	TArray<FString> IsoTexts;
+	TArray<FString> EpochTexts;
+	TArray<FString> TickTexts;
+	StructTexts.Reserve(NumRows);
+	IsoTexts.Reserve(NumRows);
+	EpochTexts.Reserve(NumRows);
+	TickTexts.Reserve(NumRows);
+
+	for (int32 RowIndex = 0; RowIndex < NumRows; RowIndex++)
+	{
+		const double Alpha = RandomStream.GetFraction();
+		const int64 Ticks = MinTicks + static_cast<int64>(Alpha * static_cast<double>(MaxTicks - MinTicks));
+		const FDateTime DateTime = FDateTime(Ticks - (Ticks % ETimespan::TicksPerSecond));
+
+		StructTexts.Add(FString::Printf(TEXT("(DateTime=%s)"), *DateTime.ToString()));
+		IsoTexts.Add(DateTime.ToIso8601());
+		EpochTexts.Add(LexToString(DateTime.ToUnixTimestamp()));
+		TickTexts.Add(LexToString(DateTime.GetTicks()));
+	}
+
+	UE_LOG(LogPickableDateTime, Display, TEXT("Importing %d rows of FPickableDateTime."), NumRows);
+
+	TArray<FPickableDateTime> Values;
+	Values.Init(FPickableDateTime(FDateTime::MinValue()), NumRows);
+
+	// The generic struct text import that was used before the dedicated import path.
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		const int32 NumErrors = ImportWithScriptStruct(StructTexts, Values, false);
+		ReportResult(TEXT("Generic struct import (DateTime=...)"), NumRows, FPlatformTime::Seconds() - StartTime, NumErrors);
+	}
+
+	// The dedicated import path through UScriptStruct, which is what DataTable CSV and JSON use.
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		const int32 NumErrors = ImportWithScriptStruct(IsoTexts, Values, true);
+		ReportResult(TEXT("ImportTextItem ISO-8601"), NumRows, FPlatformTime::Seconds() - StartTime, NumErrors);
+	}
+
+	// The parallel batch import for each format.
+	const TPair<const TCHAR*, const TArray<FString>*> BatchInputs[] =
+	{
+		{ TEXT("ParseBatch ISO-8601"), &IsoTexts },
+		{ TEXT("ParseBatch epoch seconds"), &EpochTexts },
+		{ TEXT("ParseBatch ticks"), &TickTexts },
+	};
+	for (const TPair<const TCHAR*, const TArray<FString>*>& BatchInput : BatchInputs)
+	{
+		TArray<FPickableDateTimeImportError> Errors;
+		const double StartTime = FPlatformTime::Seconds();
+		FPickableDateTimeImport::ParseBatch(*BatchInput.Value, Values, Errors);
+		ReportResult(BatchInput.Key, NumRows, FPlatformTime::Seconds() - StartTime, Errors.Num());
+	}
+
+	return 0;
+}
@@ -0,0 +1,26 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "PickableDateTimeImportBenchmarkCommandlet.generated.h"
+
+/**
+ * Commandlet that measures the import speed of FPickableDateTime values in rows per second.
+ * Compares the generic struct text import with the dedicated import path.
+ * Usage: UnrealEditor-Cmd <Project> -run=PickableDateTimeImportBenchmark [-Rows=500000] [-Seed=0]
+ */
+UCLASS()
+class UPickableDateTimeImportBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	// Constructor.
+	UPickableDateTimeImportBenchmarkCommandlet();
+
+	// UCommandlet interface.
+	virtual int32 Main(const FString& Params) override;
+	// End of UCommandlet interface.
+};
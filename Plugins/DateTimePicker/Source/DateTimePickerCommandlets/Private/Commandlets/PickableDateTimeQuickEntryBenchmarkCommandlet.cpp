@@ -0,0 +1,74 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#include "Commandlets/PickableDateTimeQuickEntryBenchmarkCommandlet.h"
+#include "PickableDateTimeQuickEntry.h"
+#include "PickableDateTimeGlobals.h"
+
+UPickableDateTimeQuickEntryBenchmarkCommandlet::UPickableDateTimeQuickEntryBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsEditor = false;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UPickableDateTimeQuickEntryBenchmarkCommandlet::Main(const FString& Params)
+{
+	int32 NumIterations = 1000000;
+	FParse::Value(*Params, TEXT("Iterations="), NumIterations);
+	NumIterations = FMath::Max(NumIterations, 1);
+
+	static const TCHAR* Expressions[] =
+	{
+		TEXT("+3d"),
+		TEXT("-2w"),
+		TEXT("next fri"),
+		TEXT("eom"),
+		TEXT("2025-06"),
+		TEXT("som +1m -1d"),
+		TEXT("2025-06-15T12:30:00Z"),
+	};
+
+	UE_LOG(LogPickableDateTime, Display, TEXT("Evaluating quick entry expressions %d times each."), NumIterations);
+
+	for (const TCHAR* Expression : Expressions)
+	{
+		FPickableDateTimeQuickEntry CompiledExpression;
+		if (!FPickableDateTimeQuickEntry::Compile(Expression, CompiledExpression))
+		{
+			UE_LOG(LogPickableDateTime, Error, TEXT("Failed to compile \"%s\"."), Expression);
+			return 1;
+		}
+
+		// Vary the reference so that the evaluation can't be hoisted out of the loop.
+		const FDateTime Reference(2024, 1, 1);
+		int64 Checksum = 0;
+
+		const double CompileStartTime = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < NumIterations; Iteration++)
+		{
+			FPickableDateTimeQuickEntry::Compile(Expression, CompiledExpression);
+		}
+		const double CompileSeconds = FPlatformTime::Seconds() - CompileStartTime;
+
+		const double EvaluateStartTime = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < NumIterations; Iteration++)
+		{
+			FDateTime Result;
+			if (CompiledExpression.Evaluate(Reference + FTimespan::FromDays(Iteration % 1000), Result))
+			{
+				Checksum += Result.GetTicks();
+			}
+		}
+		const double EvaluateSeconds = FPlatformTime::Seconds() - EvaluateStartTime;
+
+		UE_LOG(LogPickableDateTime, Display, TEXT("%-24s compile %8.1f ns, evaluate %8.1f ns (checksum %lld)"),
+			Expression,
+			(CompileSeconds * 1e9) / NumIterations,
+			(EvaluateSeconds * 1e9) / NumIterations,
+			Checksum
+		);
+	}
+
+	return 0;
+}
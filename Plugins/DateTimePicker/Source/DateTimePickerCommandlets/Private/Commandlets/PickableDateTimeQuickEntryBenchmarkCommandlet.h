@@ -0,0 +1,25 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "PickableDateTimeQuickEntryBenchmarkCommandlet.generated.h"
+
+/**
+ * Commandlet that measures the compile and evaluation time of quick entry expressions.
+ * Usage: UnrealEditor-Cmd <Project> -run=PickableDateTimeQuickEntryBenchmark [-Iterations=1000000]
+ */
+UCLASS()
+class UPickableDateTimeQuickEntryBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	// Constructor.
+	UPickableDateTimeQuickEntryBenchmarkCommandlet();
+
+	// UCommandlet interface.
+	virtual int32 Main(const FString& Params) override;
+	// End of UCommandlet interface.
+};
@@ -0,0 +1,28 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Modules/ModuleManager.h"
+#include "Benchmarks/DateTimePickerWidgetBenchmarks.h"
+
+class FDateTimePickerCommandletsModule : public IModuleInterface
+{
+public:
+	// IModuleInterface interface.
+	virtual void StartupModule() override;
+	virtual void ShutdownModule() override;
+	// End of IModuleInterface interface.
+};
+
+void FDateTimePickerCommandletsModule::StartupModule()
+{
+	// Register benchmarks.
+	FDateTimePickerWidgetBenchmarks::Register();
+}
+
+void FDateTimePickerCommandletsModule::ShutdownModule()
+{
+	// Unregister benchmarks.
+	FDateTimePickerWidgetBenchmarks::Unregister();
+}
+
+IMPLEMENT_MODULE(FDateTimePickerCommandletsModule, DateTimePickerCommandlets)
@@ -0,0 +1,519 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#include "PickableDateTimeBenchmark.h"
+#include "PickableDateTime.h"
+#include "PickableDateTimeCalendar.h"
+#include "PickableDateTimeImport.h"
+#include "PickableDateTimeQuickEntry.h"
+#include "PickableDateTimeGlobals.h"
+#include "PickableDateTimeHardwareCounters.h"
+#include "Misc/App.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonWriter.h"
+#include "Policies/PrettyJsonPrintPolicy.h"
+
+namespace PickableDateTimeBenchmarkInternal
+{
+	// The registered benchmarks by name.
+	static TMap<FString, FPickableDateTimeBenchmark::FBody> Benchmarks;
+
+	// The upper limit of the iterations of a repetition, so that a slow clock can't make the calibration run forever.
+	static constexpr int64 MaxIterations = int64(1) << 32;
+
+	// The number of distinct inputs the built-in benchmarks cycle through. Must be a power of two.
+	static constexpr int32 NumInputs = 1024;
+
+	// Results are written here so that the compiler can't optimize the benchmarked work away.
+	static volatile uint64 Sink = 0;
+
+	// Returns the seconds it took to run the body.
+	static double Measure(const FPickableDateTimeBenchmark::FBody& Body, int64 NumIterations)
+	{
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		Sink = Sink + Body(NumIterations);
+		const uint64 EndCycles = FPlatformTime::Cycles64();
+
+		return FPlatformTime::ToSeconds64(EndCycles - StartCycles);
+	}
+
+	// Returns the value at the percentile of the sorted values, using the nearest rank.
+	static double GetPercentile(const TArray<double>& SortedValues, double Percentile)
+	{
+		check(SortedValues.Num() > 0);
+
+		const int32 Rank = FMath::CeilToInt32((Percentile / 100.) * SortedValues.Num());
+		return SortedValues[FMath::Clamp(Rank - 1, 0, SortedValues.Num() - 1)];
+	}
+
+	// Returns dates spread over about 100 years with varying times of day, which the built-in benchmarks cycle through.
+	static const TArray<FDateTime>& GetInputs()
+	{
+		static TArray<FDateTime> Inputs;
+		if (Inputs.Num() == 0)
+		{
+			const int64 FirstDayNumber = PickableDateTimeCalendar::DaysFromCivil(1970, 1, 1);
+
+			FRandomStream Random(NumInputs);
+			Inputs.Reserve(NumInputs);
+			for (int32 Index = 0; Index < NumInputs; Index++)
+			{
+				const int64 DayNumber = FirstDayNumber + Random.RandRange(0, 36524);
+				const int64 TimeOfDayTicks = static_cast<int64>(Random.FRand() * (ETimespan::TicksPerDay - 1));
+				Inputs.Add(FDateTime(PickableDateTimeCalendar::FromDayNumber(DayNumber).GetTicks() + TimeOfDayTicks));
+			}
+		}
+
+		return Inputs;
+	}
+
+	// Returns the inputs formatted in ISO-8601.
+	static const TArray<FString>& GetInputTexts()
+	{
+		static TArray<FString> InputTexts;
+		if (InputTexts.Num() == 0)
+		{
+			InputTexts.Reserve(NumInputs);
+			for (const FDateTime& Input : GetInputs())
+			{
+				InputTexts.Add(Input.ToIso8601());
+			}
+		}
+
+		return InputTexts;
+	}
+}
+
+FPickableDateTimeBenchmarkSettings FPickableDateTimeBenchmarkSettings::FromParams(const TCHAR* Params)
+{
+	FPickableDateTimeBenchmarkSettings Settings;
+	FParse::Value(Params, TEXT("Filter="), Settings.Filter);
+	FParse::Value(Params, TEXT("Warmup="), Settings.NumWarmupRepetitions);
+	FParse::Value(Params, TEXT("Repetitions="), Settings.NumRepetitions);
+	FParse::Value(Params, TEXT("MinTime="), Settings.MinRepetitionSeconds);
+	FParse::Value(Params, TEXT("Label="), Settings.Label);
+	FParse::Value(Params, TEXT("Output="), Settings.OutputPath);
+	Settings.bHardwareCounters = FParse::Param(Params, TEXT("HardwareCounters"));
+
+	Settings.NumWarmupRepetitions = FMath::Max(Settings.NumWarmupRepetitions, 0);
+	Settings.NumRepetitions = FMath::Max(Settings.NumRepetitions, 1);
+	Settings.MinRepetitionSeconds = FMath::Max(Settings.MinRepetitionSeconds, 0.);
+
+	return Settings;
+}
+
+void FPickableDateTimeBenchmark::Register(const FString& Name, FBody Body)
+{
+	check(IsInGameThread());
+
+	PickableDateTimeBenchmarkInternal::Benchmarks.Add(Name, MoveTemp(Body));
+}
+
+void FPickableDateTimeBenchmark::Unregister(const FString& Name)
+{
+	check(IsInGameThread());
+
+	PickableDateTimeBenchmarkInternal::Benchmarks.Remove(Name);
+}
+
+void FPickableDateTimeBenchmark::RegisterBuiltInBenchmarks()
+{
+	using namespace PickableDateTimeBenchmarkInternal;
+
+	// Build the inputs now so that the first benchmark doesn't include it.
+	const TArray<FDateTime>& Inputs = GetInputs();
+	const TArray<FString>& InputTexts = GetInputTexts();
+
+	Register(TEXT("Construct.FromTicks"), [&Inputs](int64 NumIterations) -> uint64
+	{
+		uint64 Checksum = 0;
+		for (int64 Iteration = 0; Iteration < NumIterations; Iteration++)
+		{
+			const FPickableDateTime Value(Inputs[static_cast<int32>(Iteration & (NumInputs - 1))].GetTicks() + Iteration);
+			Checksum += Value.DateTime.GetTicks();
+		}
+		return Checksum;
+	});
+
+	Register(TEXT("Construct.FromDate"), [](int64 NumIterations) -> uint64
+	{
+		uint64 Checksum = 0;
+		for (int64 Iteration = 0; Iteration < NumIterations; Iteration++)
+		{
+			const int32 Index = static_cast<int32>(Iteration & (NumInputs - 1));
+			const FPickableDateTime Value(FDateTime(1970 + (Index & 63), 1 + (Index % 12), 1 + (Index % 28), Index % 24));
+			Checksum += Value.DateTime.GetTicks();
+		}
+		return Checksum;
+	});
+
+	// The default constructor reads the current time, which is what an added array element or property pays.
+	Register(TEXT("Construct.Now"), [](int64 NumIterations) -> uint64
+	{
+		uint64 Checksum = 0;
+		for (int64 Iteration = 0; Iteration < NumIterations; Iteration++)
+		{
+			const FPickableDateTime Value;
+			Checksum += Value.DateTime.GetTicks();
+		}
+		return Checksum;
+	});
+
+	Register(TEXT("Operators.Compare"), [&Inputs](int64 NumIterations) -> uint64
+	{
+		uint64 Checksum = 0;
+		for (int64 Iteration = 0; Iteration < NumIterations; Iteration++)
+		{
+			const FPickableDateTime A(Inputs[static_cast<int32>(Iteration & (NumInputs - 1))]);
+			const FPickableDateTime B(Inputs[static_cast<int32>((Iteration + 1) & (NumInputs - 1))]);
+			Checksum += (A < B) + (A <= B) * 2 + (A == B) * 4 + (A != B) * 8;
+		}
+		return Checksum;
+	});
+
+	Register(TEXT("Operators.AddTimespan"), [&Inputs](int64 NumIterations) -> uint64
+	{
+		uint64 Checksum = 0;
+		for (int64 Iteration = 0; Iteration < NumIterations; Iteration++)
+		{
+			FPickableDateTime Value(Inputs[static_cast<int32>(Iteration & (NumInputs - 1))]);
+			Value += FTimespan::FromHours(Iteration & 255);
+			Checksum += (Value - FTimespan::FromMinutes(Iteration & 63)).DateTime.GetTicks();
+		}
+		return Checksum;
+	});
+
+	Register(TEXT("Hash.GetTypeHash"), [&Inputs](int64 NumIterations) -> uint64
+	{
+		uint64 Checksum = 0;
+		for (int64 Iteration = 0; Iteration < NumIterations; Iteration++)
+		{
+			Checksum += GetTypeHash(FPickableDateTime(Inputs[static_cast<int32>(Iteration & (NumInputs - 1))].GetTicks() + Iteration));
+		}
+		return Checksum;
+	});
+
+	Register(TEXT("Decompose.GetDate"), [&Inputs](int64 NumIterations) -> uint64
+	{
+		uint64 Checksum = 0;
+		for (int64 Iteration = 0; Iteration < NumIterations; Iteration++)
+		{
+			int32 Year = 0, Month = 0, Day = 0;
+			Inputs[static_cast<int32>(Iteration & (NumInputs - 1))].GetDate(Year, Month, Day);
+			Checksum += Year + Month + Day;
+		}
+		return Checksum;
+	});
+
+	Register(TEXT("Decompose.CivilFromDays"), [&Inputs](int64 NumIterations) -> uint64
+	{
+		uint64 Checksum = 0;
+		for (int64 Iteration = 0; Iteration < NumIterations; Iteration++)
+		{
+			int32 Year = 0, Month = 0, Day = 0;
+			PickableDateTimeCalendar::CivilFromDays(PickableDateTimeCalendar::ToDayNumber(Inputs[static_cast<int32>(Iteration & (NumInputs - 1))]), Year, Month, Day);
+			Checksum += Year + Month + Day;
+		}
+		return Checksum;
+	});
+
+	Register(TEXT("Calendar.AddMonths"), [&Inputs](int64 NumIterations) -> uint64
+	{
+		uint64 Checksum = 0;
+		for (int64 Iteration = 0; Iteration < NumIterations; Iteration++)
+		{
+			const FDateTime Result = PickableDateTimeCalendar::AddMonths(Inputs[static_cast<int32>(Iteration & (NumInputs - 1))], static_cast<int32>(Iteration % 25) - 12);
+			Checksum += Result.GetTicks();
+		}
+		return Checksum;
+	});
+
+	Register(TEXT("Calendar.IsoWeek"), [&Inputs](int64 NumIterations) -> uint64
+	{
+		uint64 Checksum = 0;
+		for (int64 Iteration = 0; Iteration < NumIterations; Iteration++)
+		{
+			Checksum += PickableDateTimeCalendar::GetIsoWeekNumber(Inputs[static_cast<int32>(Iteration & (NumInputs - 1))]);
+		}
+		return Checksum;
+	});
+
+	Register(TEXT("Format.ToString"), [&Inputs](int64 NumIterations) -> uint64
+	{
+		uint64 Checksum = 0;
+		for (int64 Iteration = 0; Iteration < NumIterations; Iteration++)
+		{
+			Checksum += Inputs[static_cast<int32>(Iteration & (NumInputs - 1))].ToString().Len();
+		}
+		return Checksum;
+	});
+
+	Register(TEXT("Format.ToIso8601"), [&Inputs](int64 NumIterations) -> uint64
+	{
+		uint64 Checksum = 0;
+		for (int64 Iteration = 0; Iteration < NumIterations; Iteration++)
+		{
+			Checksum += Inputs[static_cast<int32>(Iteration & (NumInputs - 1))].ToIso8601().Len();
+		}
+		return Checksum;
+	});
+
+	// The localized formatting that the picker and the property customization display.
+	Register(TEXT("Format.AsDateTime"), [&Inputs](int64 NumIterations) -> uint64
+	{
+		uint64 Checksum = 0;
+		for (int64 Iteration = 0; Iteration < NumIterations; Iteration++)
+		{
+			Checksum += FText::AsDateTime(Inputs[static_cast<int32>(Iteration & (NumInputs - 1))]).ToString().Len();
+		}
+		return Checksum;
+	});
+
+	Register(TEXT("Parse.Import"), [&InputTexts](int64 NumIterations) -> uint64
+	{
+		uint64 Checksum = 0;
+		for (int64 Iteration = 0; Iteration < NumIterations; Iteration++)
+		{
+			FDateTime Result;
+			if (FPickableDateTimeImport::ParseText(*InputTexts[static_cast<int32>(Iteration & (NumInputs - 1))], Result))
+			{
+				Checksum += Result.GetTicks();
+			}
+		}
+		return Checksum;
+	});
+
+	Register(TEXT("QuickEntry.Evaluate"), [&Inputs](int64 NumIterations) -> uint64
+	{
+		static const TCHAR* Expressions[] = { TEXT("+3d"), TEXT("next fri"), TEXT("som +1m -1d"), TEXT("2025-06-15T12:30:00Z") };
+
+		uint64 Checksum = 0;
+		for (int64 Iteration = 0; Iteration < NumIterations; Iteration++)
+		{
+			FDateTime Result;
+			if (FPickableDateTimeQuickEntry::Evaluate(Expressions[Iteration % UE_ARRAY_COUNT(Expressions)], Inputs[static_cast<int32>(Iteration & (NumInputs - 1))], Result))
+			{
+				Checksum += Result.GetTicks();
+			}
+		}
+		return Checksum;
+	});
+}
+
+FPickableDateTimeBenchmarkResult FPickableDateTimeBenchmark::Run(const FString& Name, const FBody& Body, const FPickableDateTimeBenchmarkSettings& Settings)
+{
+	using namespace PickableDateTimeBenchmarkInternal;
+
+	FPickableDateTimeBenchmarkResult Result;
+	Result.Name = Name;
+
+	// Double the iterations until a repetition takes long enough for the clock resolution not to matter.
+	int64 NumIterations = 1;
+	while (NumIterations < MaxIterations && Measure(Body, NumIterations) < Settings.MinRepetitionSeconds)
+	{
+		NumIterations *= 2;
+	}
+	Result.NumIterations = NumIterations;
+
+	for (int32 Repetition = 0; Repetition < Settings.NumWarmupRepetitions; Repetition++)
+	{
+		Measure(Body, NumIterations);
+	}
+
+	FPickableDateTimeHardwareCounters HardwareCounters;
+	const bool bHardwareCounters = Settings.bHardwareCounters && HardwareCounters.Open();
+	TArray<double> CounterSamples[FPickableDateTimeHardwareCounters::NumCounters];
+
+	Result.Samples.Reserve(Settings.NumRepetitions);
+	for (int32 Repetition = 0; Repetition < Settings.NumRepetitions; Repetition++)
+	{
+		if (bHardwareCounters)
+		{
+			HardwareCounters.Start();
+		}
+
+		const double Seconds = Measure(Body, NumIterations);
+
+		uint64 CounterValues[FPickableDateTimeHardwareCounters::NumCounters];
+		if (bHardwareCounters && HardwareCounters.Stop(CounterValues))
+		{
+			for (int32 Counter = 0; Counter < FPickableDateTimeHardwareCounters::NumCounters; Counter++)
+			{
+				CounterSamples[Counter].Add(static_cast<double>(CounterValues[Counter]) / NumIterations);
+			}
+		}
+
+		Result.Samples.Add((Seconds * 1e9) / NumIterations);
+	}
+
+	Result.Samples.Sort();
+	Result.Min = Result.Samples[0];
+	Result.Median = GetPercentile(Result.Samples, 50.);
+	Result.P90 = GetPercentile(Result.Samples, 90.);
+	Result.P99 = GetPercentile(Result.Samples, 99.);
+	Result.Max = Result.Samples.Last();
+
+	double Sum = 0.;
+	for (const double Sample : Result.Samples)
+	{
+		Sum += Sample;
+	}
+	Result.Mean = Sum / Result.Samples.Num();
+
+	double SquaredDeviationSum = 0.;
+	for (const double Sample : Result.Samples)
+	{
+		SquaredDeviationSum += FMath::Square(Sample - Result.Mean);
+	}
+	Result.StandardDeviation = FMath::Sqrt(SquaredDeviationSum / Result.Samples.Num());
+
+	for (int32 Counter = 0; Counter < FPickableDateTimeHardwareCounters::NumCounters; Counter++)
+	{
+		if (CounterSamples[Counter].Num() > 0)
+		{
+			CounterSamples[Counter].Sort();
+			Result.HardwareCounters.Emplace(FPickableDateTimeHardwareCounters::GetCounterName(Counter), GetPercentile(CounterSamples[Counter], 50.));
+		}
+	}
+
+	return Result;
+}
+
+TArray<FPickableDateTimeBenchmarkResult> FPickableDateTimeBenchmark::RunAll(const FPickableDateTimeBenchmarkSettings& Settings)
+{
+	using namespace PickableDateTimeBenchmarkInternal;
+
+	check(IsInGameThread());
+
+	// Registered on demand so that games don't build the inputs at startup.
+	RegisterBuiltInBenchmarks();
+
+	if (Settings.bHardwareCounters)
+	{
+		FPickableDateTimeHardwareCounters HardwareCounters;
+		if (!HardwareCounters.Open())
+		{
+			UE_LOG(LogPickableDateTime, Warning, TEXT("Hardware counters are not available on this platform or are not permitted by the kernel. Only the time is measured."));
+		}
+	}
+
+	TArray<FString> Names;
+	Benchmarks.GetKeys(Names);
+	Names.Sort();
+
+	TArray<FPickableDateTimeBenchmarkResult> Results;
+	for (const FString& Name : Names)
+	{
+		if (!Settings.Filter.IsEmpty() && !Name.Contains(Settings.Filter))
+		{
+			continue;
+		}
+
+		Results.Add(Run(Name, Benchmarks[Name], Settings));
+	}
+
+	return Results;
+}
+
+FString FPickableDateTimeBenchmark::ToJson(const TArray<FPickableDateTimeBenchmarkResult>& Results, const FPickableDateTimeBenchmarkSettings& Settings)
+{
+	FString Json;
+	const TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(&Json);
+
+	Writer->WriteObjectStart();
+	Writer->WriteValue(TEXT("label"), Settings.Label);
+	Writer->WriteValue(TEXT("timestamp"), FDateTime::UtcNow().ToIso8601());
+	Writer->WriteValue(TEXT("platform"), FString(FPlatformProperties::IniPlatformName()));
+	Writer->WriteValue(TEXT("cpu"), FPlatformMisc::GetCPUBrand().TrimStartAndEnd());
+	Writer->WriteValue(TEXT("configuration"), FString(LexToString(FApp::GetBuildConfiguration())));
+	Writer->WriteValue(TEXT("warmup_repetitions"), Settings.NumWarmupRepetitions);
+	Writer->WriteValue(TEXT("repetitions"), Settings.NumRepetitions);
+	Writer->WriteValue(TEXT("min_repetition_seconds"), Settings.MinRepetitionSeconds);
+
+	Writer->WriteArrayStart(TEXT("benchmarks"));
+	for (const FPickableDateTimeBenchmarkResult& Result : Results)
+	{
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("name"), Result.Name);
+		Writer->WriteValue(TEXT("iterations"), Result.NumIterations);
+
+		Writer->WriteObjectStart(TEXT("ns_per_iteration"));
+		Writer->WriteValue(TEXT("min"), Result.Min);
+		Writer->WriteValue(TEXT("median"), Result.Median);
+		Writer->WriteValue(TEXT("p90"), Result.P90);
+		Writer->WriteValue(TEXT("p99"), Result.P99);
+		Writer->WriteValue(TEXT("max"), Result.Max);
+		Writer->WriteValue(TEXT("mean"), Result.Mean);
+		Writer->WriteValue(TEXT("stddev"), Result.StandardDeviation);
+		Writer->WriteObjectEnd();
+
+		Writer->WriteArrayStart(TEXT("samples"));
+		for (const double Sample : Result.Samples)
+		{
+			Writer->WriteValue(Sample);
+		}
+		Writer->WriteArrayEnd();
+
+		if (Result.HardwareCounters.Num() > 0)
+		{
+			Writer->WriteObjectStart(TEXT("counters_per_iteration"));
+			for (const TPair<FString, double>& Counter : Result.HardwareCounters)
+			{
+				Writer->WriteValue(Counter.Key, Counter.Value);
+			}
+			Writer->WriteObjectEnd();
+		}
+
+		Writer->WriteObjectEnd();
+	}
+	Writer->WriteArrayEnd();
+
+	Writer->WriteObjectEnd();
+	Writer->Close();
+
+	return Json;
+}
+
+bool FPickableDateTimeBenchmark::RunAndSave(const FPickableDateTimeBenchmarkSettings& Settings)
+{
+	const TArray<FPickableDateTimeBenchmarkResult> Results = RunAll(Settings);
+	if (Results.Num() == 0)
+	{
+		UE_LOG(LogPickableDateTime, Error, TEXT("No benchmark matches \"%s\"."), *Settings.Filter);
+		return false;
+	}
+
+	for (const FPickableDateTimeBenchmarkResult& Result : Results)
+	{
+		FString Counters;
+		for (const TPair<FString, double>& Counter : Result.HardwareCounters)
+		{
+			Counters += FString::Printf(TEXT(" %s=%.1f"), *Counter.Key, Counter.Value);
+		}
+
+		UE_LOG(LogPickableDateTime, Display, TEXT("%-24s median %10.2f ns  p90 %10.2f ns  p99 %10.2f ns  stddev %8.2f ns (%lld iterations)%s"),
+			*Result.Name,
+			Result.Median,
+			Result.P90,
+			Result.P99,
+			Result.StandardDeviation,
+			Result.NumIterations,
+			*Counters
+		);
+	}
+
+	FString OutputPath = Settings.OutputPath;
+	if (OutputPath.IsEmpty())
+	{
+		OutputPath = FPaths::ProjectSavedDir() / TEXT("Benchmarks") / FString::Printf(TEXT("DateTimePicker-%s.json"), *FDateTime::Now().ToString());
+	}
+
+	if (!FFileHelper::SaveStringToFile(ToJson(Results, Settings), *OutputPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		UE_LOG(LogPickableDateTime, Error, TEXT("Failed to write the results to %s."), *OutputPath);
+		return false;
+	}
+
+	UE_LOG(LogPickableDateTime, Display, TEXT("Wrote the results of %d benchmarks to %s."), Results.Num(), *FPaths::ConvertRelativePathToFull(OutputPath));
+	return true;
+}
@@ -0,0 +1,113 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#include "PickableDateTimeHardwareCounters.h"
+
+#if PLATFORM_LINUX
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+const TCHAR* FPickableDateTimeHardwareCounters::GetCounterName(int32 Counter)
+{
+	static const TCHAR* CounterNames[NumCounters] =
+	{
+		TEXT("cycles"),
+		TEXT("instructions"),
+		TEXT("cache_misses"),
+		TEXT("branch_misses"),
+	};
+
+	return CounterNames[Counter];
+}
+
+FPickableDateTimeHardwareCounters::~FPickableDateTimeHardwareCounters()
+{
+#if PLATFORM_LINUX
+	for (int32& FileDescriptor : FileDescriptors)
+	{
+		if (FileDescriptor >= 0)
+		{
+			close(FileDescriptor);
+			FileDescriptor = -1;
+		}
+	}
+#endif
+}
+
+bool FPickableDateTimeHardwareCounters::Open()
+{
+#if PLATFORM_LINUX
+	static const uint64 Configs[NumCounters] =
+	{
+		PERF_COUNT_HW_CPU_CYCLES,
+		PERF_COUNT_HW_INSTRUCTIONS,
+		PERF_COUNT_HW_CACHE_MISSES,
+		PERF_COUNT_HW_BRANCH_MISSES,
+	};
+
+	for (int32 Counter = 0; Counter < NumCounters; Counter++)
+	{
+		perf_event_attr Attribute;
+		FMemory::Memzero(Attribute);
+		Attribute.type = PERF_TYPE_HARDWARE;
+		Attribute.size = sizeof(perf_event_attr);
+		Attribute.config = Configs[Counter];
+		Attribute.disabled = (Counter == 0) ? 1 : 0;
+		Attribute.exclude_kernel = 1;
+		Attribute.exclude_hv = 1;
+		Attribute.read_format = PERF_FORMAT_GROUP;
+
+		// Measure the calling thread on any CPU, grouped with the first counter so that all of them run together.
+		const int32 GroupFileDescriptor = (Counter == 0) ? -1 : FileDescriptors[0];
+		FileDescriptors[Counter] = static_cast<int32>(syscall(__NR_perf_event_open, &Attribute, 0, -1, GroupFileDescriptor, 0));
+		if (FileDescriptors[Counter] < 0)
+		{
+			return false;
+		}
+	}
+
+	return true;
+#else
+	return false;
+#endif
+}
+
+void FPickableDateTimeHardwareCounters::Start()
+{
+#if PLATFORM_LINUX
+	if (FileDescriptors[0] >= 0)
+	{
+		ioctl(FileDescriptors[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+		ioctl(FileDescriptors[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+	}
+#endif
+}
+
+bool FPickableDateTimeHardwareCounters::Stop(uint64 (&OutValues)[NumCounters])
+{
+#if PLATFORM_LINUX
+	if (FileDescriptors[0] < 0)
+	{
+		return false;
+	}
+
+	ioctl(FileDescriptors[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+	// With PERF_FORMAT_GROUP, the number of counters is followed by their values.
+	uint64 Buffer[NumCounters + 1] = {};
+	if (read(FileDescriptors[0], Buffer, sizeof(Buffer)) != static_cast<ssize_t>(sizeof(Buffer)) || Buffer[0] != NumCounters)
+	{
+		return false;
+	}
+
+	for (int32 Counter = 0; Counter < NumCounters; Counter++)
+	{
+		OutValues[Counter] = Buffer[Counter + 1];
+	}
+	return true;
+#else
+	return false;
+#endif
+}
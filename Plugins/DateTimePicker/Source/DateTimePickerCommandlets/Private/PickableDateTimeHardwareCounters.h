@@ -0,0 +1,44 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Hardware performance counters of the calling thread, read through perf_event_open on Linux.
+ * On other platforms, or when the kernel does not allow access (see /proc/sys/kernel/perf_event_paranoid), Open fails.
+ */
+class FPickableDateTimeHardwareCounters
+{
+public:
+	// The counters that are measured.
+	enum ECounter
+	{
+		Cycles,
+		Instructions,
+		CacheMisses,
+		BranchMisses,
+		NumCounters,
+	};
+
+	// Returns the name of the counter used in the results.
+	static const TCHAR* GetCounterName(int32 Counter);
+
+public:
+	// Constructor and destructor.
+	FPickableDateTimeHardwareCounters() = default;
+	~FPickableDateTimeHardwareCounters();
+
+	// Opens the counters. Returns false if they are not available.
+	bool Open();
+
+	// Resets and starts the counters.
+	void Start();
+
+	// Stops the counters and reads the values counted since Start.
+	bool Stop(uint64 (&OutValues)[NumCounters]);
+
+private:
+	// The file descriptors of the counters. The first one is the group leader.
+	int32 FileDescriptors[NumCounters] = { -1, -1, -1, -1 };
+};
@@ -0,0 +1,102 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Settings of a benchmark run.
+ */
+struct DATETIMEPICKERCOMMANDLETS_API FPickableDateTimeBenchmarkSettings
+{
+public:
+	// Only benchmarks whose names contain this text are run. All benchmarks are run if empty.
+	FString Filter;
+
+	// The number of repetitions that are run and discarded before measuring.
+	int32 NumWarmupRepetitions = 3;
+
+	// The number of measured repetitions. Percentiles are taken over them.
+	int32 NumRepetitions = 20;
+
+	// The minimum duration of a repetition, which decides the number of iterations in it.
+	double MinRepetitionSeconds = 0.01;
+
+	// Whether to read hardware counters through perf_event_open. Only available on Linux.
+	bool bHardwareCounters = false;
+
+	// A label stored in the results to identify the run, e.g. a commit hash.
+	FString Label;
+
+	// The path of the JSON file to write the results to. Defaults to Saved/Benchmarks.
+	FString OutputPath;
+
+public:
+	// Reads the settings from command line style parameters:
+	// -Filter= -Warmup= -Repetitions= -MinTime= -HardwareCounters -Label= -Output=
+	static FPickableDateTimeBenchmarkSettings FromParams(const TCHAR* Params);
+};
+
+/**
+ * The measurement of a benchmark.
+ */
+struct DATETIMEPICKERCOMMANDLETS_API FPickableDateTimeBenchmarkResult
+{
+public:
+	// The name of the benchmark.
+	FString Name;
+
+	// The number of iterations in each repetition.
+	int64 NumIterations = 0;
+
+	// Nanoseconds per iteration of each measured repetition, in ascending order.
+	TArray<double> Samples;
+
+	// Statistics of the samples.
+	double Min = 0.;
+	double Median = 0.;
+	double P90 = 0.;
+	double P99 = 0.;
+	double Max = 0.;
+	double Mean = 0.;
+	double StandardDeviation = 0.;
+
+	// The median of the hardware counters per iteration, by the counter name. Empty if they were not read.
+	TArray<TPair<FString, double>> HardwareCounters;
+};
+
+/**
+ * A harness for repeatable microbenchmarks of the date and time types.
+ * Each benchmark is calibrated to run for at least MinRepetitionSeconds per repetition, warmed up and then measured
+ * over several repetitions, and the results can be written to JSON to compare them across commits.
+ * The benchmarks of the runtime types are registered when benchmarks are first run, the picker benchmarks are registered
+ * when this module starts up, and other modules can register their own. Must be used from the game thread.
+ */
+class DATETIMEPICKERCOMMANDLETS_API FPickableDateTimeBenchmark
+{
+public:
+	// Runs the operation the number of times and returns a value computed from the results,
+	// so that the compiler can't optimize the work away.
+	using FBody = TFunction<uint64(int64 NumIterations)>;
+
+public:
+	// Registers-Unregisters a benchmark.
+	static void Register(const FString& Name, FBody Body);
+	static void Unregister(const FString& Name);
+
+	// Registers the benchmarks of the runtime types. Registering them again replaces them.
+	static void RegisterBuiltInBenchmarks();
+
+	// Runs a benchmark.
+	static FPickableDateTimeBenchmarkResult Run(const FString& Name, const FBody& Body, const FPickableDateTimeBenchmarkSettings& Settings);
+
+	// Runs the registered benchmarks that match the filter, including the ones of the runtime types, in the order of their names.
+	static TArray<FPickableDateTimeBenchmarkResult> RunAll(const FPickableDateTimeBenchmarkSettings& Settings);
+
+	// Formats the results as JSON.
+	static FString ToJson(const TArray<FPickableDateTimeBenchmarkResult>& Results, const FPickableDateTimeBenchmarkSettings& Settings);
+
+	// Runs the registered benchmarks, logs a summary and writes the results to the output file.
+	// Returns false if no benchmark matched or the file could not be written.
+	static bool RunAndSave(const FPickableDateTimeBenchmarkSettings& Settings);
+};
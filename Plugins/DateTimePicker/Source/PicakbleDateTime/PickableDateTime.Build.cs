@@ -22,5 +22,11 @@ public class PickableDateTime : ModuleRules
 				"Engine",
 			}
 			);
+
+		// The asset index is only built in the editor.
+		if (Target.bBuildEditor)
+		{
+			PrivateDependencyModuleNames.Add("AssetRegistry");
+		}
 	}
 }
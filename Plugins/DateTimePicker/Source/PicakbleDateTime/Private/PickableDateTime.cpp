@@ -0,0 +1,9 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#include "PickableDateTime.h"
+#include "PickableDateTimeImport.h"
+
+bool FPickableDateTime::ImportTextItem(const TCHAR*& Buffer, int32 PortFlags, UObject* Parent, FOutputDevice* ErrorText)
+{
+	return FPickableDateTimeImport::ParseToken(Buffer, DateTime);
+}
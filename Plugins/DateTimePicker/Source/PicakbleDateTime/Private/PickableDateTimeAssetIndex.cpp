@@ -0,0 +1,366 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#include "PickableDateTimeAssetIndex.h"
+
+#if WITH_EDITOR
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Sort.h"
+#include "Algo/Unique.h"
+#include "Misc/ScopeRWLock.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectHash.h"
+#include "UObject/ObjectSaveContext.h"
+#include "PickableDateTimeGlobals.h"
+
+namespace PickableDateTimeAssetIndexInternal
+{
+	// The index created by Get.
+	static TUniquePtr<FPickableDateTimeAssetIndex> Instance;
+}
+
+FPickableDateTimeAssetIndex& FPickableDateTimeAssetIndex::Get()
+{
+	using namespace PickableDateTimeAssetIndexInternal;
+
+	if (!Instance.IsValid())
+	{
+		check(IsInGameThread());
+
+		Instance = MakeUnique<FPickableDateTimeAssetIndex>();
+		Instance->BindEvents();
+		Instance->Rebuild();
+	}
+
+	return *Instance;
+}
+
+void FPickableDateTimeAssetIndex::Shutdown()
+{
+	PickableDateTimeAssetIndexInternal::Instance.Reset();
+}
+
+FPickableDateTimeAssetIndex::~FPickableDateTimeAssetIndex()
+{
+	UnbindEvents();
+}
+
+void FPickableDateTimeAssetIndex::QueryRange(const FDateTime& First, const FDateTime& Last, TArray<FResult>& OutResults, FName TagName) const
+{
+	FReadScopeLock ReadLock(Lock);
+
+	const int32 TagIndex = TagName.IsNone() ? INDEX_NONE : FindTagIndexLocked(TagName);
+	if (!TagName.IsNone() && TagIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	const int32 FirstEntryIndex = Algo::LowerBoundBy(Entries, First.GetTicks(), &FEntry::Ticks);
+	const int32 EndEntryIndex = Algo::UpperBoundBy(Entries, Last.GetTicks(), &FEntry::Ticks);
+	for (int32 EntryIndex = FirstEntryIndex; EntryIndex < EndEntryIndex; EntryIndex++)
+	{
+		const FEntry& Entry = Entries[EntryIndex];
+		if (TagIndex == INDEX_NONE || Entry.TagIndex == TagIndex)
+		{
+			OutResults.Add({ AssetPaths[Entry.AssetIndex], TagNames[Entry.TagIndex], FDateTime(Entry.Ticks) });
+		}
+	}
+}
+
+void FPickableDateTimeAssetIndex::QueryAssetsInRange(const FDateTime& First, const FDateTime& Last, TArray<FSoftObjectPath>& OutAssetPaths, FName TagName) const
+{
+	FReadScopeLock ReadLock(Lock);
+
+	const int32 TagIndex = TagName.IsNone() ? INDEX_NONE : FindTagIndexLocked(TagName);
+	if (!TagName.IsNone() && TagIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	TBitArray<> bAdded(false, AssetPaths.Num());
+	const int32 FirstEntryIndex = Algo::LowerBoundBy(Entries, First.GetTicks(), &FEntry::Ticks);
+	const int32 EndEntryIndex = Algo::UpperBoundBy(Entries, Last.GetTicks(), &FEntry::Ticks);
+	for (int32 EntryIndex = FirstEntryIndex; EntryIndex < EndEntryIndex; EntryIndex++)
+	{
+		const FEntry& Entry = Entries[EntryIndex];
+		if ((TagIndex == INDEX_NONE || Entry.TagIndex == TagIndex) && !bAdded[Entry.AssetIndex])
+		{
+			bAdded[Entry.AssetIndex] = true;
+			OutAssetPaths.Add(AssetPaths[Entry.AssetIndex]);
+		}
+	}
+}
+
+void FPickableDateTimeAssetIndex::UpdateAsset(const FSoftObjectPath& AssetPath, TConstArrayView<FPickableDateTimeAssetTags::FValue> Values)
+{
+	FWriteScopeLock WriteLock(Lock);
+
+	if (const int32* AssetIndex = AssetIndices.Find(AssetPath))
+	{
+		RemoveAssetLocked(*AssetIndex);
+	}
+
+	if (!Values.IsEmpty())
+	{
+		AddAssetLocked(AssetPath, Values, true);
+	}
+}
+
+void FPickableDateTimeAssetIndex::RemoveAsset(const FSoftObjectPath& AssetPath)
+{
+	FWriteScopeLock WriteLock(Lock);
+
+	if (const int32* AssetIndex = AssetIndices.Find(AssetPath))
+	{
+		RemoveAssetLocked(*AssetIndex);
+	}
+}
+
+void FPickableDateTimeAssetIndex::Rebuild()
+{
+	const double StartTime = FPlatformTime::Seconds();
+	const IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+
+	FWriteScopeLock WriteLock(Lock);
+
+	Entries.Reset();
+	AssetPaths.Reset();
+	AssetIndices.Reset();
+	FreeAssetIndices.Reset();
+	AssetTicks.Reset();
+	TagNames.Reset();
+	TagIndices.Reset();
+
+	// Append all values and sort them once at the end.
+	TArray<FPickableDateTimeAssetTags::FValue> Values;
+	AssetRegistry.EnumerateAllAssets(
+		[this, &Values](const FAssetData& AssetData) -> bool
+		{
+			Values.Reset();
+			if (FPickableDateTimeAssetTags::GetValuesFromAssetData(AssetData, Values) > 0)
+			{
+				AddAssetLocked(AssetData.GetSoftObjectPath(), Values, false);
+			}
+			return true;
+		}
+	);
+	Algo::Sort(Entries);
+
+	UE_LOG(LogPickableDateTime, Verbose, TEXT("Built the date time asset index of %d values in %d assets in %.1f ms."),
+		Entries.Num(),
+		AssetIndices.Num(),
+		(FPlatformTime::Seconds() - StartTime) * 1000.
+	);
+}
+
+int32 FPickableDateTimeAssetIndex::GetNumValues() const
+{
+	FReadScopeLock ReadLock(Lock);
+	return Entries.Num();
+}
+
+int32 FPickableDateTimeAssetIndex::GetNumAssets() const
+{
+	FReadScopeLock ReadLock(Lock);
+	return AssetIndices.Num();
+}
+
+void FPickableDateTimeAssetIndex::BindEvents()
+{
+	IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+	OnAssetAddedHandle = AssetRegistry.OnAssetAdded().AddRaw(this, &FPickableDateTimeAssetIndex::HandleOnAssetAddedOrUpdated);
+	OnAssetUpdatedHandle = AssetRegistry.OnAssetUpdated().AddRaw(this, &FPickableDateTimeAssetIndex::HandleOnAssetAddedOrUpdated);
+	OnAssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FPickableDateTimeAssetIndex::HandleOnAssetRemoved);
+	OnAssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FPickableDateTimeAssetIndex::HandleOnAssetRenamed);
+	OnFilesLoadedHandle = AssetRegistry.OnFilesLoaded().AddRaw(this, &FPickableDateTimeAssetIndex::HandleOnFilesLoaded);
+	OnPackageSavedHandle = UPackage::PackageSavedWithContextEvent.AddRaw(this, &FPickableDateTimeAssetIndex::HandleOnPackageSaved);
+}
+
+void FPickableDateTimeAssetIndex::UnbindEvents()
+{
+	if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+	{
+		AssetRegistry->OnAssetAdded().Remove(OnAssetAddedHandle);
+		AssetRegistry->OnAssetUpdated().Remove(OnAssetUpdatedHandle);
+		AssetRegistry->OnAssetRemoved().Remove(OnAssetRemovedHandle);
+		AssetRegistry->OnAssetRenamed().Remove(OnAssetRenamedHandle);
+		AssetRegistry->OnFilesLoaded().Remove(OnFilesLoadedHandle);
+	}
+
+	UPackage::PackageSavedWithContextEvent.Remove(OnPackageSavedHandle);
+}
+
+void FPickableDateTimeAssetIndex::HandleOnAssetAddedOrUpdated(const FAssetData& AssetData)
+{
+	// Assets discovered by the initial scan are indexed all at once when it finishes.
+	if (IAssetRegistry::GetChecked().IsLoadingAssets())
+	{
+		return;
+	}
+
+	TArray<FPickableDateTimeAssetTags::FValue> Values;
+	FPickableDateTimeAssetTags::GetValuesFromAssetData(AssetData, Values);
+	UpdateAsset(AssetData.GetSoftObjectPath(), Values);
+}
+
+void FPickableDateTimeAssetIndex::HandleOnAssetRemoved(const FAssetData& AssetData)
+{
+	RemoveAsset(AssetData.GetSoftObjectPath());
+}
+
+void FPickableDateTimeAssetIndex::HandleOnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+	const FSoftObjectPath OldAssetPath(OldObjectPath);
+	bool bWasIndexed = false;
+	{
+		FReadScopeLock ReadLock(Lock);
+		bWasIndexed = AssetIndices.Contains(OldAssetPath);
+	}
+
+	RemoveAsset(OldAssetPath);
+
+	// Queries made before the initial scan finishes would otherwise miss an asset that was already indexed, so move it even while loading.
+	if (bWasIndexed || !IAssetRegistry::GetChecked().IsLoadingAssets())
+	{
+		TArray<FPickableDateTimeAssetTags::FValue> Values;
+		FPickableDateTimeAssetTags::GetValuesFromAssetData(AssetData, Values);
+		UpdateAsset(AssetData.GetSoftObjectPath(), Values);
+	}
+}
+
+void FPickableDateTimeAssetIndex::HandleOnFilesLoaded()
+{
+	Rebuild();
+}
+
+void FPickableDateTimeAssetIndex::HandleOnPackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext ObjectSaveContext)
+{
+	if (Package == nullptr || ObjectSaveContext.IsProceduralSave())
+	{
+		return;
+	}
+
+	ForEachObjectWithPackage(
+		Package,
+		[this](UObject* Object) -> bool
+		{
+			if (Object->IsAsset())
+			{
+				TArray<FPickableDateTimeAssetTags::FValue> Values;
+				FPickableDateTimeAssetTags::CollectValues(Object, Values);
+				UpdateAsset(FSoftObjectPath(Object), Values);
+			}
+			return true;
+		},
+		false
+	);
+}
+
+void FPickableDateTimeAssetIndex::AddAssetLocked(const FSoftObjectPath& AssetPath, TConstArrayView<FPickableDateTimeAssetTags::FValue> Values, bool bKeepSorted)
+{
+	int32 AssetIndex = INDEX_NONE;
+	if (FreeAssetIndices.Num() > 0)
+	{
+		AssetIndex = FreeAssetIndices.Pop(false);
+		AssetPaths[AssetIndex] = AssetPath;
+	}
+	else
+	{
+		AssetIndex = AssetPaths.Add(AssetPath);
+		AssetTicks.AddDefaulted();
+	}
+	AssetIndices.Add(AssetPath, AssetIndex);
+
+	const int32 NumOldEntries = Entries.Num();
+	TArray<int64>& Ticks = AssetTicks[AssetIndex];
+	Ticks.Reset(Values.Num());
+	for (const FPickableDateTimeAssetTags::FValue& Value : Values)
+	{
+		int32 TagIndex = FindTagIndexLocked(Value.TagName);
+		if (TagIndex == INDEX_NONE)
+		{
+			TagIndex = TagNames.Add(Value.TagName);
+			TagIndices.Add(Value.TagName, TagIndex);
+		}
+
+		Entries.Add({ Value.DateTime.GetTicks(), AssetIndex, TagIndex });
+		Ticks.Add(Value.DateTime.GetTicks());
+	}
+
+	Algo::Sort(Ticks);
+	Ticks.SetNum(Algo::Unique(Ticks), false);
+
+	if (!bKeepSorted)
+	{
+		return;
+	}
+
+	// Sort the new entries, then merge them from the back so that only the entries after the first insertion point move.
+	TArray<FEntry> NewEntries(MakeArrayView(Entries).RightChop(NumOldEntries));
+	Algo::Sort(NewEntries);
+
+	int32 WriteIndex = Entries.Num() - 1;
+	int32 OldIndex = NumOldEntries - 1;
+	for (int32 NewIndex = NewEntries.Num() - 1; NewIndex >= 0; WriteIndex--)
+	{
+		if (OldIndex >= 0 && NewEntries[NewIndex] < Entries[OldIndex])
+		{
+			Entries[WriteIndex] = Entries[OldIndex--];
+		}
+		else
+		{
+			Entries[WriteIndex] = NewEntries[NewIndex--];
+		}
+	}
+}
+
+void FPickableDateTimeAssetIndex::RemoveAssetLocked(int32 AssetIndex)
+{
+	// Entries are ordered by (Ticks, AssetIndex), so the entries of the asset with each of its ticks are one run found by binary search.
+	// The runs are in ascending order, so the remaining entries are compacted in one pass starting from the first of them.
+	int32 WriteIndex = INDEX_NONE;
+	int32 ReadIndex = INDEX_NONE;
+	for (const int64 Ticks : AssetTicks[AssetIndex])
+	{
+		const int32 RunStart = Algo::LowerBound(Entries, FEntry{ Ticks, AssetIndex, 0 });
+		int32 RunEnd = RunStart;
+		while (RunEnd < Entries.Num() && Entries[RunEnd].Ticks == Ticks && Entries[RunEnd].AssetIndex == AssetIndex)
+		{
+			RunEnd++;
+		}
+
+		if (WriteIndex == INDEX_NONE)
+		{
+			WriteIndex = RunStart;
+		}
+		else
+		{
+			for (; ReadIndex < RunStart; ReadIndex++)
+			{
+				Entries[WriteIndex++] = Entries[ReadIndex];
+			}
+		}
+		ReadIndex = RunEnd;
+	}
+
+	if (WriteIndex != INDEX_NONE)
+	{
+		for (; ReadIndex < Entries.Num(); ReadIndex++)
+		{
+			Entries[WriteIndex++] = Entries[ReadIndex];
+		}
+		Entries.SetNum(WriteIndex, false);
+	}
+
+	AssetIndices.Remove(AssetPaths[AssetIndex]);
+	AssetPaths[AssetIndex].Reset();
+	AssetTicks[AssetIndex].Empty();
+	FreeAssetIndices.Add(AssetIndex);
+}
+
+int32 FPickableDateTimeAssetIndex::FindTagIndexLocked(FName TagName) const
+{
+	const int32* TagIndex = TagIndices.Find(TagName);
+	return (TagIndex != nullptr) ? *TagIndex : INDEX_NONE;
+}
+#endif
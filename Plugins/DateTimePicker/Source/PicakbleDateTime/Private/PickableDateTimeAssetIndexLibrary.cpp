@@ -0,0 +1,15 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#include "PickableDateTimeAssetIndexLibrary.h"
+#include "PickableDateTimeAssetIndex.h"
+
+#if WITH_EDITOR
+TArray<FSoftObjectPath> UPickableDateTimeAssetIndexLibrary::FindAssetsInDateRange(const FPickableDateTime& From, const FPickableDateTime& To, const FString& PropertyPath)
+{
+	const FName TagName = PropertyPath.IsEmpty() ? NAME_None : FPickableDateTimeAssetTags::MakeTagName(PropertyPath);
+
+	TArray<FSoftObjectPath> AssetPaths;
+	FPickableDateTimeAssetIndex::Get().QueryAssetsInRange(From.DateTime, To.DateTime, AssetPaths, TagName);
+	return AssetPaths;
+}
+#endif
@@ -0,0 +1,378 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#include "PickableDateTimeAssetTags.h"
+#include "PickableDateTime.h"
+#include "PickableDateTimeImport.h"
+#include "AssetRegistry/AssetData.h"
+#include "Engine/Blueprint.h"
+#include "UObject/UnrealType.h"
+#include "UObject/ObjectKey.h"
+#include "Misc/ScopeLock.h"
+
+namespace PickableDateTimeAssetTagsInternal
+{
+	// The format of a single value in a tag. FDateTime::Parse also accepts it.
+	static const TCHAR* ValueFormat = TEXT("%Y.%m.%d-%H.%M.%S.%s");
+
+	// The maximum depth of nested structs to look into.
+	static constexpr int32 MaxStructDepth = 8;
+
+	// Handle of the event called when the tags of an object are gathered.
+	static FDelegateHandle OnGetExtraObjectTagsHandle;
+
+	// Whether each native struct or class contains FPickableDateTime, so that most objects are skipped without walking their properties.
+	static TMap<TObjectKey<UStruct>, bool> ContainsCache;
+	static FCriticalSection ContainsCacheCriticalSection;
+
+	static bool ContainsPickableDateTime(const FProperty* Property, TSet<const UStruct*>& Visited);
+
+	// Returns whether the struct contains FPickableDateTime. Structs that were already visited are not searched again,
+	// which makes the search terminate for structs that contain arrays of themselves.
+	static bool ContainsPickableDateTime(const UStruct* Struct, TSet<const UStruct*>& Visited)
+	{
+		if (Struct == FPickableDateTime::StaticStruct())
+		{
+			return true;
+		}
+
+		bool bAlreadyVisited = false;
+		Visited.Add(Struct, &bAlreadyVisited);
+		if (bAlreadyVisited)
+		{
+			return false;
+		}
+
+		for (TFieldIterator<FProperty> It(Struct); It; ++It)
+		{
+			if (ContainsPickableDateTime(*It, Visited))
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	// Returns whether the value of the property contains FPickableDateTime.
+	static bool ContainsPickableDateTime(const FProperty* Property, TSet<const UStruct*>& Visited)
+	{
+		if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+		{
+			return ContainsPickableDateTime(StructProperty->Struct, Visited);
+		}
+		if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+		{
+			return ContainsPickableDateTime(ArrayProperty->Inner, Visited);
+		}
+		if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+		{
+			return ContainsPickableDateTime(SetProperty->ElementProp, Visited);
+		}
+		if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+		{
+			return ContainsPickableDateTime(MapProperty->KeyProp, Visited) || ContainsPickableDateTime(MapProperty->ValueProp, Visited);
+		}
+
+		return false;
+	}
+
+	// Returns whether the struct contains FPickableDateTime, using the cached result if possible.
+	static bool ContainsPickableDateTime(const UStruct* Struct)
+	{
+		// Blueprint generated classes and user defined structs are recompiled and reinstanced in place,
+		// so only the results of native types, which can only contain other native types, are cached.
+		bool bCanCache = false;
+		if (const UClass* Class = Cast<UClass>(Struct))
+		{
+			bCanCache = Class->HasAnyClassFlags(CLASS_Native);
+		}
+		else if (const UScriptStruct* ScriptStruct = Cast<UScriptStruct>(Struct))
+		{
+			bCanCache = ((ScriptStruct->StructFlags & STRUCT_Native) != 0);
+		}
+
+		if (bCanCache)
+		{
+			FScopeLock Lock(&ContainsCacheCriticalSection);
+			if (const bool* bCachedContains = ContainsCache.Find(Struct))
+			{
+				return *bCachedContains;
+			}
+		}
+
+		TSet<const UStruct*> Visited;
+		const bool bContains = ContainsPickableDateTime(Struct, Visited);
+
+		if (bCanCache)
+		{
+			FScopeLock Lock(&ContainsCacheCriticalSection);
+			ContainsCache.Add(Struct, bContains);
+		}
+
+		return bContains;
+	}
+
+	// Returns whether the value of the property may contain FPickableDateTime.
+	static bool MayContainPickableDateTime(const FProperty* Property)
+	{
+		if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+		{
+			return ContainsPickableDateTime(StructProperty->Struct);
+		}
+		if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+		{
+			return MayContainPickableDateTime(ArrayProperty->Inner);
+		}
+		if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+		{
+			return MayContainPickableDateTime(SetProperty->ElementProp);
+		}
+		if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+		{
+			return MayContainPickableDateTime(MapProperty->KeyProp) || MayContainPickableDateTime(MapProperty->ValueProp);
+		}
+
+		return false;
+	}
+
+	static void CollectFromStruct(const UStruct* Struct, const void* Container, FStringBuilderBase& Path, TArray<FPickableDateTimeAssetTags::FValue>& OutValues, int32 Depth);
+
+	// Collects the values in the value of the property.
+	static void CollectFromProperty(const FProperty* Property, const void* ValuePtr, FStringBuilderBase& Path, TArray<FPickableDateTimeAssetTags::FValue>& OutValues, int32 Depth)
+	{
+		if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+		{
+			if (StructProperty->Struct == FPickableDateTime::StaticStruct())
+			{
+				OutValues.Add({ FPickableDateTimeAssetTags::MakeTagName(Path.ToView()), static_cast<const FPickableDateTime*>(ValuePtr)->DateTime });
+			}
+			else if (Depth < MaxStructDepth)
+			{
+				CollectFromStruct(StructProperty->Struct, ValuePtr, Path, OutValues, Depth + 1);
+			}
+		}
+		else if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+		{
+			FScriptArrayHelper ArrayHelper(ArrayProperty, ValuePtr);
+			for (int32 Index = 0; Index < ArrayHelper.Num(); Index++)
+			{
+				CollectFromProperty(ArrayProperty->Inner, ArrayHelper.GetRawPtr(Index), Path, OutValues, Depth);
+			}
+		}
+		else if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+		{
+			FScriptSetHelper SetHelper(SetProperty, ValuePtr);
+			for (int32 Index = 0; Index < SetHelper.GetMaxIndex(); Index++)
+			{
+				if (SetHelper.IsValidIndex(Index))
+				{
+					CollectFromProperty(SetProperty->ElementProp, SetHelper.GetElementPtr(Index), Path, OutValues, Depth);
+				}
+			}
+		}
+		else if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+		{
+			FScriptMapHelper MapHelper(MapProperty, ValuePtr);
+			for (int32 Index = 0; Index < MapHelper.GetMaxIndex(); Index++)
+			{
+				if (MapHelper.IsValidIndex(Index))
+				{
+					CollectFromProperty(MapProperty->KeyProp, MapHelper.GetKeyPtr(Index), Path, OutValues, Depth);
+					CollectFromProperty(MapProperty->ValueProp, MapHelper.GetValuePtr(Index), Path, OutValues, Depth);
+				}
+			}
+		}
+	}
+
+	// Collects the values in the properties of the struct or object.
+	static void CollectFromStruct(const UStruct* Struct, const void* Container, FStringBuilderBase& Path, TArray<FPickableDateTimeAssetTags::FValue>& OutValues, int32 Depth)
+	{
+		for (TFieldIterator<FProperty> It(Struct); It; ++It)
+		{
+			const FProperty* Property = *It;
+			if (Property->HasAnyPropertyFlags(CPF_Transient) || !MayContainPickableDateTime(Property))
+			{
+				continue;
+			}
+
+			const int32 PathLength = Path.Len();
+			if (PathLength > 0)
+			{
+				Path << TEXT('.');
+			}
+			Property->GetFName().AppendString(Path);
+
+			for (int32 ArrayIndex = 0; ArrayIndex < Property->ArrayDim; ArrayIndex++)
+			{
+				CollectFromProperty(Property, Property->ContainerPtrToValuePtr<void>(Container, ArrayIndex), Path, OutValues, Depth);
+			}
+
+			Path.RemoveSuffix(Path.Len() - PathLength);
+		}
+	}
+}
+
+const TCHAR* FPickableDateTimeAssetTags::TagPrefix = TEXT("PickableDateTime.");
+
+void FPickableDateTimeAssetTags::Register()
+{
+#if WITH_EDITOR
+	PickableDateTimeAssetTagsInternal::OnGetExtraObjectTagsHandle = UObject::FAssetRegistryTag::OnGetExtraObjectTags.AddStatic(&FPickableDateTimeAssetTags::GetAssetRegistryTags);
+#endif
+}
+
+void FPickableDateTimeAssetTags::Unregister()
+{
+#if WITH_EDITOR
+	UObject::FAssetRegistryTag::OnGetExtraObjectTags.Remove(PickableDateTimeAssetTagsInternal::OnGetExtraObjectTagsHandle);
+#endif
+
+	FScopeLock Lock(&PickableDateTimeAssetTagsInternal::ContainsCacheCriticalSection);
+	PickableDateTimeAssetTagsInternal::ContainsCache.Empty();
+}
+
+void FPickableDateTimeAssetTags::GetAssetRegistryTags(const UObject* Object, TArray<UObject::FAssetRegistryTag>& OutTags)
+{
+	TArray<FValue> Values;
+	CollectValues(Object, Values);
+	if (Values.IsEmpty())
+	{
+		return;
+	}
+
+	// Values of the same property, e.g. the elements of an array, are exported in one tag.
+	TArray<FName> TagNames;
+	TMap<FName, TArray<FDateTime>> DateTimesByTag;
+	for (const FValue& Value : Values)
+	{
+		TArray<FDateTime>* DateTimes = DateTimesByTag.Find(Value.TagName);
+		if (DateTimes == nullptr)
+		{
+			TagNames.Add(Value.TagName);
+			DateTimes = &DateTimesByTag.Add(Value.TagName);
+		}
+		DateTimes->Add(Value.DateTime);
+	}
+
+	for (const FName& TagName : TagNames)
+	{
+		const TArray<FDateTime>& DateTimes = DateTimesByTag.FindChecked(TagName);
+		if (DateTimes.Num() == 1)
+		{
+			OutTags.Add(UObject::FAssetRegistryTag(
+				TagName,
+				MakeTagValue(DateTimes),
+				UObject::FAssetRegistryTag::TT_Chronological,
+				UObject::FAssetRegistryTag::TD_Date | UObject::FAssetRegistryTag::TD_Time
+			));
+		}
+		else
+		{
+			OutTags.Add(UObject::FAssetRegistryTag(TagName, MakeTagValue(DateTimes), UObject::FAssetRegistryTag::TT_Alphabetical));
+		}
+	}
+}
+
+void FPickableDateTimeAssetTags::CollectValues(const UObject* Object, TArray<FValue>& OutValues)
+{
+	using namespace PickableDateTimeAssetTagsInternal;
+
+#if WITH_EDITORONLY_DATA
+	// Blueprints keep their values in the default object of the generated class.
+	if (const UBlueprint* Blueprint = Cast<UBlueprint>(Object))
+	{
+		Object = (Blueprint->GeneratedClass != nullptr) ? Blueprint->GeneratedClass->GetDefaultObject() : nullptr;
+	}
+#endif
+
+	if (!IsValid(Object) || !ContainsPickableDateTime(Object->GetClass()))
+	{
+		return;
+	}
+
+	TStringBuilder<256> Path;
+	CollectFromStruct(Object->GetClass(), Object, Path, OutValues, 0);
+}
+
+int32 FPickableDateTimeAssetTags::GetValuesFromAssetData(const FAssetData& AssetData, TArray<FValue>& OutValues)
+{
+	int32 NumFound = 0;
+	TArray<FDateTime> DateTimes;
+	AssetData.TagsAndValues.ForEach(
+		[&NumFound, &DateTimes, &OutValues](const TPair<FName, FAssetTagValueRef>& TagAndValue)
+		{
+			if (!IsTagName(TagAndValue.Key))
+			{
+				return;
+			}
+
+			DateTimes.Reset();
+			ParseTagValue(*TagAndValue.Value.AsString(), DateTimes);
+			for (const FDateTime& DateTime : DateTimes)
+			{
+				OutValues.Add({ TagAndValue.Key, DateTime });
+			}
+			NumFound += DateTimes.Num();
+		}
+	);
+
+	return NumFound;
+}
+
+bool FPickableDateTimeAssetTags::IsTagName(FName TagName)
+{
+	TStringBuilder<128> TagNameString;
+	TagName.AppendString(TagNameString);
+	return TagNameString.ToView().StartsWith(TagPrefix, ESearchCase::IgnoreCase);
+}
+
+FName FPickableDateTimeAssetTags::MakeTagName(FStringView PropertyPath)
+{
+	TStringBuilder<256> TagName;
+	TagName << TagPrefix << PropertyPath;
+	return FName(TagName.ToString());
+}
+
+FString FPickableDateTimeAssetTags::MakeTagValue(TConstArrayView<FDateTime> DateTimes)
+{
+	TStringBuilder<256> TagValue;
+	for (const FDateTime& DateTime : DateTimes)
+	{
+		if (TagValue.Len() > 0)
+		{
+			TagValue << TEXT(',');
+		}
+		TagValue << DateTime.ToString(PickableDateTimeAssetTagsInternal::ValueFormat);
+	}
+
+	return FString(TagValue.ToView());
+}
+
+int32 FPickableDateTimeAssetTags::ParseTagValue(const TCHAR* TagValue, TArray<FDateTime>& OutDateTimes)
+{
+	int32 NumFound = 0;
+	const TCHAR* Cursor = TagValue;
+	while (Cursor != nullptr && *Cursor != TEXT('\0'))
+	{
+		FDateTime DateTime;
+		if (!FPickableDateTimeImport::ParseToken(Cursor, DateTime))
+		{
+			break;
+		}
+
+		OutDateTimes.Add(DateTime);
+		NumFound++;
+
+		while (FChar::IsWhitespace(*Cursor))
+		{
+			Cursor++;
+		}
+		if (*Cursor != TEXT(','))
+		{
+			break;
+		}
+		Cursor++;
+	}
+
+	return NumFound;
+}
@@ -0,0 +1,136 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#include "PickableDateTimeCalendarDescriptor.h"
+#include "PickableDateTimeCalendar.h"
+#include "Internationalization/Culture.h"
+
+#define LOCTEXT_NAMESPACE "PickableDateTimeCalendarDescriptor"
+
+namespace PickableDateTimeCalendarDescriptorInternal
+{
+	// The descriptor of the current culture.
+	static TSharedPtr<const FPickableDateTimeCalendarDescriptor> CachedDescriptor;
+
+	// Regions whose week starts on Sunday (from the CLDR week data).
+	static const TCHAR* SundayStartRegions[] =
+	{
+		TEXT("AG"), TEXT("AS"), TEXT("BD"), TEXT("BR"), TEXT("BS"), TEXT("BT"), TEXT("BW"), TEXT("BZ"), TEXT("CA"), TEXT("CN"),
+		TEXT("CO"), TEXT("DM"), TEXT("DO"), TEXT("ET"), TEXT("GT"), TEXT("GU"), TEXT("HK"), TEXT("HN"), TEXT("ID"), TEXT("IL"),
+		TEXT("IN"), TEXT("JM"), TEXT("JP"), TEXT("KE"), TEXT("KH"), TEXT("KR"), TEXT("LA"), TEXT("MH"), TEXT("MM"), TEXT("MO"),
+		TEXT("MT"), TEXT("MX"), TEXT("MZ"), TEXT("NI"), TEXT("NP"), TEXT("PA"), TEXT("PE"), TEXT("PH"), TEXT("PK"), TEXT("PR"),
+		TEXT("PT"), TEXT("PY"), TEXT("SA"), TEXT("SG"), TEXT("SV"), TEXT("TH"), TEXT("TT"), TEXT("TW"), TEXT("UM"), TEXT("US"),
+		TEXT("VE"), TEXT("VI"), TEXT("WS"), TEXT("YE"), TEXT("ZA"), TEXT("ZW"),
+	};
+
+	// Regions whose week starts on Saturday (from the CLDR week data).
+	static const TCHAR* SaturdayStartRegions[] =
+	{
+		TEXT("AE"), TEXT("AF"), TEXT("BH"), TEXT("DJ"), TEXT("DZ"), TEXT("EG"), TEXT("IQ"), TEXT("IR"), TEXT("JO"), TEXT("KW"),
+		TEXT("LY"), TEXT("OM"), TEXT("QA"), TEXT("SD"), TEXT("SY"),
+	};
+
+	// Returns whether the region is in the list.
+	template<int32 NumRegions>
+	static bool ContainsRegion(const TCHAR* (&Regions)[NumRegions], const FString& Region)
+	{
+		for (const TCHAR* Candidate : Regions)
+		{
+			if (Region.Equals(Candidate, ESearchCase::IgnoreCase))
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	// Returns the first day of the week of the region. Regions not in the lists start on Monday.
+	static EDayOfWeek GetFirstDayOfWeek(const FString& Region)
+	{
+		if (ContainsRegion(SundayStartRegions, Region))
+		{
+			return EDayOfWeek::Sunday;
+		}
+		if (ContainsRegion(SaturdayStartRegions, Region))
+		{
+			return EDayOfWeek::Saturday;
+		}
+
+		return EDayOfWeek::Monday;
+	}
+}
+
+TSharedRef<const FPickableDateTimeCalendarDescriptor> FPickableDateTimeCalendarDescriptor::Get()
+{
+	using namespace PickableDateTimeCalendarDescriptorInternal;
+
+	check(IsInGameThread());
+
+	if (!CachedDescriptor.IsValid())
+	{
+		CachedDescriptor = Create(FInternationalization::Get().GetCurrentCulture());
+	}
+
+	return CachedDescriptor.ToSharedRef();
+}
+
+void FPickableDateTimeCalendarDescriptor::Invalidate()
+{
+	PickableDateTimeCalendarDescriptorInternal::CachedDescriptor.Reset();
+}
+
+TSharedRef<FPickableDateTimeCalendarDescriptor> FPickableDateTimeCalendarDescriptor::Create(const FCultureRef& Culture)
+{
+	TSharedRef<FPickableDateTimeCalendarDescriptor> Descriptor = MakeShared<FPickableDateTimeCalendarDescriptor>();
+	Descriptor->CultureName = Culture->GetName();
+	Descriptor->Culture = Culture;
+	Descriptor->FirstDayOfWeek = PickableDateTimeCalendarDescriptorInternal::GetFirstDayOfWeek(Culture->GetRegion());
+
+	// January 1, 2024 is a Monday, so the following 7 days are in the order of EDayOfWeek.
+	const FString TimeZone = FText::GetInvariantTimeZone();
+	for (int32 DayIndex = 0; DayIndex < 7; DayIndex++)
+	{
+		Descriptor->ShortDayNames[DayIndex] = FText::AsDateTime(FDateTime(2024, 1, 1 + DayIndex), TEXT("EEE"), TimeZone, Culture);
+	}
+
+	for (int32 MonthIndex = 0; MonthIndex < 12; MonthIndex++)
+	{
+		Descriptor->MonthNames[MonthIndex] = FText::AsDateTime(FDateTime(2024, 1 + MonthIndex, 1), TEXT("MMMM"), TimeZone, Culture);
+	}
+
+	Descriptor->WeekNumberHeader = LOCTEXT("WeekNumberHeader", "Wk");
+
+	for (int32 Number = 0; Number <= MaxCachedNumber; Number++)
+	{
+		Descriptor->NumberTexts[Number] = FText::AsNumber(Number, &FNumberFormattingOptions::DefaultNoGrouping(), Culture);
+	}
+
+	return Descriptor;
+}
+
+EDayOfWeek FPickableDateTimeCalendarDescriptor::GetDayOfWeekOfColumn(EDayOfWeek InFirstDayOfWeek, int32 Column)
+{
+	return static_cast<EDayOfWeek>((static_cast<int32>(InFirstDayOfWeek) + Column) % 7);
+}
+
+int32 FPickableDateTimeCalendarDescriptor::GetColumnOfDayOfWeek(EDayOfWeek InFirstDayOfWeek, EDayOfWeek DayOfWeek)
+{
+	return (static_cast<int32>(DayOfWeek) - static_cast<int32>(InFirstDayOfWeek) + 7) % 7;
+}
+
+int32 FPickableDateTimeCalendarDescriptor::GetIsoWeekNumber(const FDateTime& DateTime)
+{
+	return PickableDateTimeCalendar::GetIsoWeekNumber(DateTime);
+}
+
+FText FPickableDateTimeCalendarDescriptor::GetNumberText(int32 Number) const
+{
+	if (Number >= 0 && Number <= MaxCachedNumber)
+	{
+		return NumberTexts[Number];
+	}
+
+	return FText::AsNumber(Number, &FNumberFormattingOptions::DefaultNoGrouping(), Culture);
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,224 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#include "PickableDateTimeConstraints.h"
+#include "PickableDateTimeGlobals.h"
+#include "UObject/UnrealType.h"
+
+namespace PickableDateTimeConstraintsInternal
+{
+	// A mask with all the cells of the day mode calendar grid set.
+	static constexpr uint64 DayGridMask = (1ull << FPickableDateTimeConstraints::NumDayGridCells) - 1;
+
+	// Multiplying a 7 bit pattern by this value repeats it for each week of the day mode calendar grid.
+	static constexpr uint64 WeekReplicator =
+		(1ull << 0) | (1ull << 7) | (1ull << 14) | (1ull << 21) | (1ull << 28) | (1ull << 35);
+
+	// The weekend bits of a week starting on Monday (Saturday is bit 5, Sunday is bit 6).
+	static constexpr uint64 MondayStartWeekendPattern = 0b1100000;
+
+	// Returns whether the day of the week is Saturday or Sunday.
+	static bool IsWeekend(const FDateTime& DateTime)
+	{
+		const EDayOfWeek DayOfWeek = DateTime.GetDayOfWeek();
+		return (DayOfWeek == EDayOfWeek::Saturday || DayOfWeek == EDayOfWeek::Sunday);
+	}
+
+	// Parses the date string written in the metadata.
+	static TOptional<FDateTime> ParseDate(const FString& DateString)
+	{
+		const FString TrimmedString = DateString.TrimStartAndEnd();
+		if (TrimmedString.IsEmpty())
+		{
+			return {};
+		}
+
+		FDateTime DateTime;
+		if (FDateTime::ParseIso8601(*TrimmedString, DateTime) || FDateTime::Parse(TrimmedString, DateTime))
+		{
+			// Constraints are evaluated on a per-day basis.
+			return DateTime.GetDate();
+		}
+
+		UE_LOG(LogPickableDateTime, Warning, TEXT("Failed to parse \"%s\" as a date constraint."), *TrimmedString);
+		return {};
+	}
+}
+
+FPickableDateTimeConstraints FPickableDateTimeConstraints::FromMetaData(const FString& MinDateString, const FString& MaxDateString, bool bInDisallowWeekends)
+{
+	FPickableDateTimeConstraints Constraints;
+	Constraints.MinDate = PickableDateTimeConstraintsInternal::ParseDate(MinDateString);
+	Constraints.MaxDate = PickableDateTimeConstraintsInternal::ParseDate(MaxDateString);
+	Constraints.bDisallowWeekends = bInDisallowWeekends;
+
+	if (Constraints.MinDate.IsSet() && Constraints.MaxDate.IsSet() && Constraints.MinDate.GetValue() > Constraints.MaxDate.GetValue())
+	{
+		UE_LOG(LogPickableDateTime, Warning, TEXT("MinDate (%s) is later than MaxDate (%s). The values are swapped."), *MinDateString, *MaxDateString);
+		Swap(Constraints.MinDate, Constraints.MaxDate);
+	}
+
+	return Constraints;
+}
+
+#if WITH_EDITOR
+FPickableDateTimeConstraints FPickableDateTimeConstraints::FromProperty(const FProperty* Property)
+{
+	if (Property == nullptr)
+	{
+		return {};
+	}
+
+	return FromMetaData(
+		Property->GetMetaData(PickableDateTimeMetaData::MinDate),
+		Property->GetMetaData(PickableDateTimeMetaData::MaxDate),
+		Property->HasMetaData(PickableDateTimeMetaData::DisallowWeekends)
+	);
+}
+#endif
+
+bool FPickableDateTimeConstraints::IsConstrained() const
+{
+	return (MinDate.IsSet() || MaxDate.IsSet() || bDisallowWeekends);
+}
+
+bool FPickableDateTimeConstraints::IsAllowed(const FDateTime& DateTime) const
+{
+	const FDateTime Date = DateTime.GetDate();
+	if (MinDate.IsSet() && Date < MinDate.GetValue())
+	{
+		return false;
+	}
+	if (MaxDate.IsSet() && Date > MaxDate.GetValue())
+	{
+		return false;
+	}
+	if (bDisallowWeekends && PickableDateTimeConstraintsInternal::IsWeekend(Date))
+	{
+		return false;
+	}
+
+	return true;
+}
+
+bool FPickableDateTimeConstraints::TryClamp(const FDateTime& DateTime, FDateTime& OutDateTime) const
+{
+	// Keep the time of day and only move the date.
+	const FTimespan TimeOfDay = DateTime.GetTimeOfDay();
+	FDateTime Date = DateTime.GetDate();
+
+	if (MinDate.IsSet() && Date < MinDate.GetValue())
+	{
+		Date = MinDate.GetValue();
+	}
+	if (MaxDate.IsSet() && Date > MaxDate.GetValue())
+	{
+		Date = MaxDate.GetValue();
+	}
+
+	if (bDisallowWeekends && PickableDateTimeConstraintsInternal::IsWeekend(Date))
+	{
+		// The previous Friday and the following Monday are the closest weekdays in each direction.
+		// If both are out of range, the range has no weekdays at all.
+		const int32 DayOfWeekIndex = static_cast<int32>(Date.GetDayOfWeek());
+		const FDateTime NextMonday = Date + FTimespan::FromDays(7 - DayOfWeekIndex);
+		const FDateTime PreviousFriday = Date - FTimespan::FromDays(DayOfWeekIndex - static_cast<int32>(EDayOfWeek::Friday));
+		const bool bCanMoveForward = (!MaxDate.IsSet() || NextMonday <= MaxDate.GetValue());
+		const bool bCanMoveBackward = (!MinDate.IsSet() || PreviousFriday >= MinDate.GetValue());
+
+		if (!bCanMoveForward && !bCanMoveBackward)
+		{
+			OutDateTime = Date + TimeOfDay;
+			return false;
+		}
+
+		// Saturday is closer to Friday and Sunday is closer to Monday.
+		const bool bPreferForward = (Date.GetDayOfWeek() == EDayOfWeek::Sunday);
+		Date = (bCanMoveForward && (bPreferForward || !bCanMoveBackward)) ? NextMonday : PreviousFriday;
+	}
+
+	OutDateTime = Date + TimeOfDay;
+	return true;
+}
+
+FDateTime FPickableDateTimeConstraints::Clamp(const FDateTime& DateTime) const
+{
+	FDateTime ClampedDateTime;
+	TryClamp(DateTime, ClampedDateTime);
+	return ClampedDateTime;
+}
+
+uint64 FPickableDateTimeConstraints::GetDisabledDayMask(const FDateTime& FirstGridDate) const
+{
+	using namespace PickableDateTimeConstraintsInternal;
+
+	const FDateTime FirstDate = FirstGridDate.GetDate();
+	uint64 DisabledMask = 0;
+
+	if (MinDate.IsSet())
+	{
+		const int64 MinIndex = (MinDate.GetValue() - FirstDate).GetTicks() / ETimespan::TicksPerDay;
+		DisabledMask |= MakeDayGridRangeMask(0, MinIndex - 1);
+	}
+	if (MaxDate.IsSet())
+	{
+		const int64 MaxIndex = (MaxDate.GetValue() - FirstDate).GetTicks() / ETimespan::TicksPerDay;
+		DisabledMask |= MakeDayGridRangeMask(MaxIndex + 1, NumDayGridCells - 1);
+	}
+	if (bDisallowWeekends)
+	{
+		// Rotate the weekend pattern so that bit 0 is the day of the week of the first grid.
+		const int32 Shift = static_cast<int32>(FirstDate.GetDayOfWeek());
+		const uint64 WeekPattern = ((MondayStartWeekendPattern >> Shift) | (MondayStartWeekendPattern << (7 - Shift))) & 0x7F;
+		DisabledMask |= WeekPattern * WeekReplicator;
+	}
+
+	return (DisabledMask & DayGridMask);
+}
+
+bool FPickableDateTimeConstraints::Validate(TConstArrayView<FPickableDateTime> Values, TArray<int32>& OutInvalidIndices) const
+{
+	const int32 NumInvalidBefore = OutInvalidIndices.Num();
+	if (IsConstrained())
+	{
+		for (int32 Index = 0; Index < Values.Num(); Index++)
+		{
+			if (!IsAllowed(Values[Index].DateTime))
+			{
+				OutInvalidIndices.Add(Index);
+			}
+		}
+	}
+
+	return (OutInvalidIndices.Num() == NumInvalidBefore);
+}
+
+bool FPickableDateTimeConstraints::Validate(TConstArrayView<FDateTime> Values, TArray<int32>& OutInvalidIndices) const
+{
+	const int32 NumInvalidBefore = OutInvalidIndices.Num();
+	if (IsConstrained())
+	{
+		for (int32 Index = 0; Index < Values.Num(); Index++)
+		{
+			if (!IsAllowed(Values[Index]))
+			{
+				OutInvalidIndices.Add(Index);
+			}
+		}
+	}
+
+	return (OutInvalidIndices.Num() == NumInvalidBefore);
+}
+
+uint64 FPickableDateTimeConstraints::MakeDayGridRangeMask(int64 FirstIndex, int64 LastIndex)
+{
+	using namespace PickableDateTimeConstraintsInternal;
+
+	FirstIndex = FMath::Max<int64>(FirstIndex, 0);
+	LastIndex = FMath::Min<int64>(LastIndex, NumDayGridCells - 1);
+	if (FirstIndex > LastIndex)
+	{
+		return 0;
+	}
+
+	return (DayGridMask >> (NumDayGridCells - 1 - LastIndex)) & (DayGridMask << FirstIndex);
+}
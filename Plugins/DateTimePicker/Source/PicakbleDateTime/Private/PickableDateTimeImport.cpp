@@ -0,0 +1,298 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#include "PickableDateTimeImport.h"
+#include "Async/ParallelFor.h"
+
+namespace PickableDateTimeImportInternal
+{
+	// The ticks of 1970-01-01T00:00:00Z.
+	static constexpr int64 UnixEpochTicks = 621355968000000000;
+
+	// Integers of this many digits or more are treated as FDateTime ticks (10^16 ticks is about the year 32).
+	static constexpr int32 MinTicksDigits = 17;
+
+	// Integers of this many digits or more are treated as milliseconds (10^11 seconds is about the year 5138).
+	static constexpr int32 MinMillisecondsDigits = 12;
+
+	// Shorter integers are rejected, so that a year such as 2024 or a date such as 20240131 is not read as seconds (10^8 seconds is 1973).
+	static constexpr int32 MinSecondsDigits = 9;
+
+	// Returns whether the character ends a token that is not enclosed in quotes.
+	static bool IsTokenDelimiter(TCHAR Character)
+	{
+		return (Character == TEXT('\0') || Character == TEXT(',') || Character == TEXT(')') || FChar::IsWhitespace(Character));
+	}
+
+	// Parses an unsigned decimal number of up to 19 digits.
+	static bool ParseDigits(const TCHAR*& Cursor, const TCHAR* End, uint64& OutValue, int32 MaxDigits = 19)
+	{
+		const TCHAR* Start = Cursor;
+		uint64 Value = 0;
+		while (Cursor < End && FChar::IsDigit(*Cursor))
+		{
+			if (Cursor - Start >= MaxDigits)
+			{
+				return false;
+			}
+
+			Value = (Value * 10) + (*Cursor - TEXT('0'));
+			Cursor++;
+		}
+
+		OutValue = Value;
+		return (Cursor != Start);
+	}
+
+	// Converts a tick count to FDateTime if it is within the valid range.
+	static bool TicksToDateTime(int64 Ticks, FDateTime& OutDateTime)
+	{
+		if (Ticks < FDateTime::MinValue().GetTicks() || Ticks > FDateTime::MaxValue().GetTicks())
+		{
+			return false;
+		}
+
+		OutDateTime = FDateTime(Ticks);
+		return true;
+	}
+
+	// Parses an integer as ticks, epoch milliseconds or epoch seconds depending on the number of digits, including leading zeros.
+	static bool ParseInteger(const TCHAR* Token, int32 Length, FDateTime& OutDateTime)
+	{
+		const TCHAR* Cursor = Token;
+		const TCHAR* End = Token + Length;
+
+		const bool bNegative = (*Cursor == TEXT('-'));
+		if (bNegative || *Cursor == TEXT('+'))
+		{
+			Cursor++;
+		}
+
+		const TCHAR* DigitsStart = Cursor;
+		uint64 Magnitude = 0;
+		if (!ParseDigits(Cursor, End, Magnitude) || Cursor != End || Magnitude > static_cast<uint64>(MAX_int64))
+		{
+			return false;
+		}
+
+		const int32 NumDigits = static_cast<int32>(Cursor - DigitsStart);
+		if (NumDigits < MinSecondsDigits)
+		{
+			return false;
+		}
+
+		const int64 Value = bNegative ? -static_cast<int64>(Magnitude) : static_cast<int64>(Magnitude);
+		if (NumDigits >= MinTicksDigits)
+		{
+			return TicksToDateTime(Value, OutDateTime);
+		}
+		if (NumDigits >= MinMillisecondsDigits)
+		{
+			// Reject values that would overflow when converted to ticks.
+			if (Magnitude > static_cast<uint64>(FDateTime::MaxValue().GetTicks() / ETimespan::TicksPerMillisecond))
+			{
+				return false;
+			}
+
+			return TicksToDateTime(UnixEpochTicks + (Value * ETimespan::TicksPerMillisecond), OutDateTime);
+		}
+
+		return TicksToDateTime(UnixEpochTicks + (Value * ETimespan::TicksPerSecond), OutDateTime);
+	}
+
+	// Parses the format of FDateTime::ToString (yyyy.mm.dd-hh.mm.ss[.mmm]).
+	static bool ParseDotted(const TCHAR* Token, int32 Length, FDateTime& OutDateTime)
+	{
+		const TCHAR* Cursor = Token;
+		const TCHAR* End = Token + Length;
+
+		static constexpr TCHAR Separators[] = { TEXT('.'), TEXT('.'), TEXT('-'), TEXT('.'), TEXT('.'), TEXT('.') };
+		uint64 Components[7] = { 0, 1, 1, 0, 0, 0, 0 };
+
+		int32 NumComponents = 0;
+		while (NumComponents < static_cast<int32>(UE_ARRAY_COUNT(Components)))
+		{
+			if (!ParseDigits(Cursor, End, Components[NumComponents], 4))
+			{
+				return false;
+			}
+			NumComponents++;
+
+			if (Cursor == End)
+			{
+				break;
+			}
+			if (NumComponents > static_cast<int32>(UE_ARRAY_COUNT(Separators)) || *Cursor != Separators[NumComponents - 1])
+			{
+				return false;
+			}
+			Cursor++;
+		}
+
+		// At least the date part is required.
+		if (Cursor != End || NumComponents < 3)
+		{
+			return false;
+		}
+
+		const int32 Year = static_cast<int32>(Components[0]);
+		const int32 Month = static_cast<int32>(Components[1]);
+		const int32 Day = static_cast<int32>(Components[2]);
+		const int32 Hour = static_cast<int32>(Components[3]);
+		const int32 Minute = static_cast<int32>(Components[4]);
+		const int32 Second = static_cast<int32>(Components[5]);
+		const int32 Millisecond = static_cast<int32>(Components[6]);
+		if (!FDateTime::Validate(Year, Month, Day, Hour, Minute, Second, Millisecond))
+		{
+			return false;
+		}
+
+		OutDateTime = FDateTime(Year, Month, Day, Hour, Minute, Second, Millisecond);
+		return true;
+	}
+
+	// Parses a null-terminated token that has no surrounding whitespace or quotes.
+	static bool ParseTrimmedToken(const TCHAR* Token, int32 Length, FDateTime& OutDateTime)
+	{
+		if (Length <= 0)
+		{
+			return false;
+		}
+
+		return (
+			ParseInteger(Token, Length, OutDateTime) ||
+			ParseDotted(Token, Length, OutDateTime) ||
+			FDateTime::ParseIso8601(Token, OutDateTime)
+		);
+	}
+}
+
+FString FPickableDateTimeImport::MakeText(const FDateTime& DateTime)
+{
+	// Always write 19 digits, so that the integer is classified as ticks even for dates in the first centuries.
+	return FString::Printf(TEXT("%019lld"), DateTime.GetTicks());
+}
+
+bool FPickableDateTimeImport::ParseText(const TCHAR* Text, FDateTime& OutDateTime)
+{
+	if (Text == nullptr)
+	{
+		return false;
+	}
+
+	const TCHAR* Cursor = Text;
+	FDateTime ParsedDateTime;
+	if (!ParseToken(Cursor, ParsedDateTime))
+	{
+		return false;
+	}
+
+	// Only whitespace is allowed after the token.
+	while (FChar::IsWhitespace(*Cursor))
+	{
+		Cursor++;
+	}
+	if (*Cursor != TEXT('\0'))
+	{
+		return false;
+	}
+
+	OutDateTime = ParsedDateTime;
+	return true;
+}
+
+bool FPickableDateTimeImport::ParseToken(const TCHAR*& Buffer, FDateTime& OutDateTime)
+{
+	using namespace PickableDateTimeImportInternal;
+
+	if (Buffer == nullptr)
+	{
+		return false;
+	}
+
+	const TCHAR* Cursor = Buffer;
+	while (FChar::IsWhitespace(*Cursor))
+	{
+		Cursor++;
+	}
+
+	const bool bQuoted = (*Cursor == TEXT('"'));
+	if (bQuoted)
+	{
+		Cursor++;
+	}
+
+	// Copy the token to a null-terminated buffer on the stack so that no allocation occurs.
+	TCHAR Token[MaxTextLength + 1];
+	int32 Length = 0;
+	while (bQuoted ? (*Cursor != TEXT('"') && *Cursor != TEXT('\0')) : !IsTokenDelimiter(*Cursor))
+	{
+		if (Length >= MaxTextLength)
+		{
+			return false;
+		}
+
+		Token[Length++] = *Cursor++;
+	}
+
+	if (bQuoted)
+	{
+		if (*Cursor != TEXT('"'))
+		{
+			return false;
+		}
+		Cursor++;
+
+		// Whitespace inside quotes is not part of the date and time.
+		while (Length > 0 && FChar::IsWhitespace(Token[Length - 1]))
+		{
+			Length--;
+		}
+	}
+	Token[Length] = TEXT('\0');
+
+	const TCHAR* TrimmedToken = Token;
+	while (FChar::IsWhitespace(*TrimmedToken))
+	{
+		TrimmedToken++;
+		Length--;
+	}
+
+	FDateTime ParsedDateTime;
+	if (!ParseTrimmedToken(TrimmedToken, Length, ParsedDateTime))
+	{
+		return false;
+	}
+
+	OutDateTime = ParsedDateTime;
+	Buffer = Cursor;
+	return true;
+}
+
+bool FPickableDateTimeImport::ParseBatch(TConstArrayView<FString> Texts, TArray<FPickableDateTime>& OutValues, TArray<FPickableDateTimeImportError>& OutErrors)
+{
+	OutValues.Reset(Texts.Num());
+	OutValues.Init(FPickableDateTime(FDateTime::MinValue()), Texts.Num());
+
+	// Each row writes only to its own elements, so no synchronization is needed.
+	TArray<bool> Failed;
+	Failed.Init(false, Texts.Num());
+
+	ParallelFor(Texts.Num(), [&Texts, &OutValues, &Failed](int32 RowIndex)
+	{
+		Failed[RowIndex] = !ParseText(*Texts[RowIndex], OutValues[RowIndex].DateTime);
+	});
+
+	// Collect errors in row order so that the report is deterministic.
+	const int32 NumErrorsBefore = OutErrors.Num();
+	for (int32 RowIndex = 0; RowIndex < Failed.Num(); RowIndex++)
+	{
+		if (Failed[RowIndex])
+		{
+			FPickableDateTimeImportError& Error = OutErrors.AddDefaulted_GetRef();
+			Error.RowIndex = RowIndex;
+			Error.Text = Texts[RowIndex];
+		}
+	}
+
+	return (OutErrors.Num() == NumErrorsBefore);
+}
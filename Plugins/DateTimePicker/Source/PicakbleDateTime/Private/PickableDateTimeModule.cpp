@@ -2,14 +2,50 @@
 
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
+#include "PickableDateTimeGlobals.h"
+#include "PickableDateTimeCalendarDescriptor.h"
+#include "PickableDateTimeAssetTags.h"
+#include "PickableDateTimeAssetIndex.h"
+
+DEFINE_LOG_CATEGORY(LogPickableDateTime);
 
 class FPickableDateTimeModule : public IModuleInterface
 {
 public:
 	// IModuleInterface interface.
-	virtual void StartupModule() override {}
-	virtual void ShutdownModule() override {}
+	virtual void StartupModule() override;
+	virtual void ShutdownModule() override;
 	// End of IModuleInterface interface.
+
+private:
+	// Handle of the event called when the culture is changed.
+	FDelegateHandle OnCultureChangedHandle;
 };
-	
+
+void FPickableDateTimeModule::StartupModule()
+{
+	// Resolve the calendar descriptor again for the new culture.
+	OnCultureChangedHandle = FInternationalization::Get().OnCultureChanged().AddStatic(&FPickableDateTimeCalendarDescriptor::Invalidate);
+
+#if WITH_EDITOR
+	// Export the values of FPickableDateTime properties as Asset Registry tags when assets are saved.
+	FPickableDateTimeAssetTags::Register();
+#endif
+}
+
+void FPickableDateTimeModule::ShutdownModule()
+{
+	if (FInternationalization::IsAvailable())
+	{
+		FInternationalization::Get().OnCultureChanged().Remove(OnCultureChangedHandle);
+	}
+
+	FPickableDateTimeCalendarDescriptor::Invalidate();
+
+#if WITH_EDITOR
+	FPickableDateTimeAssetIndex::Shutdown();
+	FPickableDateTimeAssetTags::Unregister();
+#endif
+}
+
 IMPLEMENT_MODULE(FPickableDateTimeModule, PickableDateTime)
\ No newline at end of file
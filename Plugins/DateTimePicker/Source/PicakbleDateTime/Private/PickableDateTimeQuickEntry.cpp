@@ -0,0 +1,418 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#include "PickableDateTimeQuickEntry.h"
+#include "PickableDateTimeCalendar.h"
+#include "PickableDateTimeImport.h"
+
+namespace PickableDateTimeQuickEntryInternal
+{
+	using EOperation = FPickableDateTimeQuickEntry::EOperation;
+
+	// A word and the value it stands for.
+	struct FKeyword
+	{
+		const TCHAR* Word;
+		int64 Value;
+	};
+
+	// Units of offsets and the number of ticks of each unit. Months and years are handled separately.
+	static constexpr int64 MonthUnit = -1;
+	static constexpr int64 YearUnit = -2;
+	static const FKeyword Units[] =
+	{
+		{ TEXT("d"), ETimespan::TicksPerDay }, { TEXT("day"), ETimespan::TicksPerDay }, { TEXT("days"), ETimespan::TicksPerDay },
+		{ TEXT("w"), ETimespan::TicksPerWeek }, { TEXT("wk"), ETimespan::TicksPerWeek }, { TEXT("wks"), ETimespan::TicksPerWeek },
+		{ TEXT("week"), ETimespan::TicksPerWeek }, { TEXT("weeks"), ETimespan::TicksPerWeek },
+		{ TEXT("h"), ETimespan::TicksPerHour }, { TEXT("hr"), ETimespan::TicksPerHour }, { TEXT("hrs"), ETimespan::TicksPerHour },
+		{ TEXT("hour"), ETimespan::TicksPerHour }, { TEXT("hours"), ETimespan::TicksPerHour },
+		{ TEXT("min"), ETimespan::TicksPerMinute }, { TEXT("mins"), ETimespan::TicksPerMinute },
+		{ TEXT("minute"), ETimespan::TicksPerMinute }, { TEXT("minutes"), ETimespan::TicksPerMinute },
+		{ TEXT("m"), MonthUnit }, { TEXT("mo"), MonthUnit }, { TEXT("mos"), MonthUnit }, { TEXT("month"), MonthUnit }, { TEXT("months"), MonthUnit },
+		{ TEXT("y"), YearUnit }, { TEXT("yr"), YearUnit }, { TEXT("yrs"), YearUnit }, { TEXT("year"), YearUnit }, { TEXT("years"), YearUnit },
+	};
+
+	// Names of the days of the week and the index of EDayOfWeek.
+	static const FKeyword Weekdays[] =
+	{
+		{ TEXT("mon"), 0 }, { TEXT("monday"), 0 },
+		{ TEXT("tue"), 1 }, { TEXT("tues"), 1 }, { TEXT("tuesday"), 1 },
+		{ TEXT("wed"), 2 }, { TEXT("wednesday"), 2 },
+		{ TEXT("thu"), 3 }, { TEXT("thur"), 3 }, { TEXT("thurs"), 3 }, { TEXT("thursday"), 3 },
+		{ TEXT("fri"), 4 }, { TEXT("friday"), 4 },
+		{ TEXT("sat"), 5 }, { TEXT("saturday"), 5 },
+		{ TEXT("sun"), 6 }, { TEXT("sunday"), 6 },
+	};
+
+	// Words that compile to a single operation.
+	static const FKeyword Anchors[] =
+	{
+		{ TEXT("now"), static_cast<int64>(EOperation::SetNow) },
+		{ TEXT("today"), static_cast<int64>(EOperation::SetToday) },
+		{ TEXT("sow"), static_cast<int64>(EOperation::StartOfWeek) },
+		{ TEXT("eow"), static_cast<int64>(EOperation::EndOfWeek) },
+		{ TEXT("som"), static_cast<int64>(EOperation::StartOfMonth) },
+		{ TEXT("eom"), static_cast<int64>(EOperation::EndOfMonth) },
+		{ TEXT("soy"), static_cast<int64>(EOperation::StartOfYear) },
+		{ TEXT("eoy"), static_cast<int64>(EOperation::EndOfYear) },
+	};
+
+	// Finds the word in the table.
+	template<int32 NumKeywords>
+	static bool FindKeyword(FStringView Word, const FKeyword (&Keywords)[NumKeywords], int64& OutValue)
+	{
+		for (const FKeyword& Keyword : Keywords)
+		{
+			if (Word.Equals(Keyword.Word, ESearchCase::IgnoreCase))
+			{
+				OutValue = Keyword.Value;
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	// Splits off the next whitespace separated word.
+	static FStringView NextWord(FStringView& Remaining)
+	{
+		Remaining.TrimStartInline();
+
+		int32 Length = 0;
+		while (Length < Remaining.Len() && !FChar::IsWhitespace(Remaining[Length]))
+		{
+			Length++;
+		}
+
+		const FStringView Word = Remaining.Left(Length);
+		Remaining.RightChopInline(Length);
+		return Word;
+	}
+
+	// The maximum number of digits in a number, which keeps any offset within the range of int64 ticks.
+	static constexpr int32 MaxDigits = 6;
+
+	// Parses the leading digits of the word. Returns the number of digits read.
+	static int32 ParseDigits(FStringView Word, int64& OutValue)
+	{
+		int32 NumDigits = 0;
+		int64 Value = 0;
+		while (NumDigits < Word.Len() && NumDigits < MaxDigits && FChar::IsDigit(Word[NumDigits]))
+		{
+			Value = (Value * 10) + (Word[NumDigits] - TEXT('0'));
+			NumDigits++;
+		}
+
+		OutValue = Value;
+		return NumDigits;
+	}
+
+	// Parses YYYY, YYYY-MM or YYYY-MM-DD as the ticks of the date.
+	static bool ParseDateLiteral(FStringView Word, int64& OutTicks)
+	{
+		int32 Components[3] = { 0, 1, 1 };
+		static constexpr int32 ComponentLengths[3] = { 4, 2, 2 };
+
+		int32 NumComponents = 0;
+		while (NumComponents < 3)
+		{
+			int64 Value = 0;
+			if (ParseDigits(Word, Value) != ComponentLengths[NumComponents])
+			{
+				return false;
+			}
+
+			Components[NumComponents++] = static_cast<int32>(Value);
+			Word.RightChopInline(ComponentLengths[NumComponents - 1]);
+
+			if (Word.IsEmpty())
+			{
+				break;
+			}
+			if (Word[0] != TEXT('-'))
+			{
+				return false;
+			}
+			Word.RightChopInline(1);
+		}
+
+		if (!Word.IsEmpty() || !FDateTime::Validate(Components[0], Components[1], Components[2], 0, 0, 0, 0))
+		{
+			return false;
+		}
+
+		OutTicks = FDateTime(Components[0], Components[1], Components[2]).GetTicks();
+		return true;
+	}
+
+	// Parses an ISO-8601 date and time.
+	static bool ParseIso8601(FStringView Word, int64& OutTicks)
+	{
+		if (Word.Len() > FPickableDateTimeImport::MaxTextLength)
+		{
+			return false;
+		}
+
+		// FDateTime::ParseIso8601 needs a null-terminated string, so copy it to the stack.
+		TCHAR Buffer[FPickableDateTimeImport::MaxTextLength + 1];
+		FMemory::Memcpy(Buffer, Word.GetData(), Word.Len() * sizeof(TCHAR));
+		Buffer[Word.Len()] = TEXT('\0');
+
+		FDateTime DateTime;
+		if (!FDateTime::ParseIso8601(Buffer, DateTime))
+		{
+			return false;
+		}
+
+		OutTicks = DateTime.GetTicks();
+		return true;
+	}
+
+	// Converts an offset to an operation.
+	static FPickableDateTimeQuickEntry::FStep MakeOffsetStep(int64 Amount, int64 Unit)
+	{
+		FPickableDateTimeQuickEntry::FStep Step;
+		if (Unit == MonthUnit)
+		{
+			Step.Operation = EOperation::AddMonths;
+			Step.Value = Amount;
+		}
+		else if (Unit == YearUnit)
+		{
+			Step.Operation = EOperation::AddMonths;
+			Step.Value = Amount * 12;
+		}
+		else if (Unit == ETimespan::TicksPerDay || Unit == ETimespan::TicksPerWeek)
+		{
+			Step.Operation = EOperation::AddDays;
+			Step.Value = Amount * (Unit / ETimespan::TicksPerDay);
+		}
+		else
+		{
+			Step.Operation = EOperation::AddTicks;
+			Step.Value = Amount * Unit;
+		}
+
+		return Step;
+	}
+
+	// Returns the ticks of the time of day.
+	FORCEINLINE int64 GetTimeOfDayTicks(int64 Ticks)
+	{
+		return Ticks % ETimespan::TicksPerDay;
+	}
+
+	// Returns the number of days since January 1, 0001.
+	FORCEINLINE int64 GetDayNumber(int64 Ticks)
+	{
+		return Ticks / ETimespan::TicksPerDay;
+	}
+
+	// Moves the date to the day number, keeping the time of day.
+	FORCEINLINE int64 SetDayNumber(int64 Ticks, int64 DayNumber)
+	{
+		return (DayNumber * ETimespan::TicksPerDay) + GetTimeOfDayTicks(Ticks);
+	}
+}
+
+bool FPickableDateTimeQuickEntry::Compile(FStringView Text, FPickableDateTimeQuickEntry& OutExpression)
+{
+	using namespace PickableDateTimeQuickEntryInternal;
+
+	FPickableDateTimeQuickEntry Expression;
+	auto AddStep = [&Expression](EOperation Operation, int64 Value) -> bool
+	{
+		if (Expression.NumSteps >= MaxSteps)
+		{
+			return false;
+		}
+
+		Expression.Steps[Expression.NumSteps].Operation = Operation;
+		Expression.Steps[Expression.NumSteps].Value = Value;
+		Expression.NumSteps++;
+		return true;
+	};
+
+	FStringView Remaining = Text;
+	for (FStringView Word = NextWord(Remaining); !Word.IsEmpty(); Word = NextWord(Remaining))
+	{
+		int64 Value = 0;
+		bool bSucceeded = false;
+
+		if (FindKeyword(Word, Anchors, Value))
+		{
+			bSucceeded = AddStep(static_cast<EOperation>(Value), 0);
+		}
+		else if (Word.Equals(TEXT("tomorrow"), ESearchCase::IgnoreCase) || Word.Equals(TEXT("yesterday"), ESearchCase::IgnoreCase))
+		{
+			const int64 NumDays = (Word[0] == TEXT('t') || Word[0] == TEXT('T')) ? 1 : -1;
+			bSucceeded = AddStep(EOperation::SetToday, 0) && AddStep(EOperation::AddDays, NumDays);
+		}
+		else if (Word.Equals(TEXT("next"), ESearchCase::IgnoreCase) || Word.Equals(TEXT("last"), ESearchCase::IgnoreCase))
+		{
+			const EOperation Operation = (Word[0] == TEXT('n') || Word[0] == TEXT('N')) ? EOperation::NextWeekday : EOperation::PreviousWeekday;
+			bSucceeded = FindKeyword(NextWord(Remaining), Weekdays, Value) && AddStep(Operation, Value);
+		}
+		else if (FindKeyword(Word, Weekdays, Value))
+		{
+			bSucceeded = AddStep(EOperation::OnOrAfterWeekday, Value);
+		}
+		else if (ParseDateLiteral(Word, Value))
+		{
+			// A four digit number followed by a unit is an offset, e.g. "1000 days".
+			FStringView Lookahead = Remaining;
+			int64 Unit = 0;
+			if (Word.Len() == 4 && FindKeyword(NextWord(Lookahead), Units, Unit))
+			{
+				int64 Amount = 0;
+				ParseDigits(Word, Amount);
+
+				const FStep Step = MakeOffsetStep(Amount, Unit);
+				Remaining = Lookahead;
+				bSucceeded = AddStep(Step.Operation, Step.Value);
+			}
+			else
+			{
+				bSucceeded = AddStep(EOperation::SetDate, Value);
+			}
+		}
+		else if (Word[0] == TEXT('+') || Word[0] == TEXT('-') || FChar::IsDigit(Word[0]))
+		{
+			// An offset such as "+3d", "-2 weeks" or "3 days".
+			const int64 Sign = (Word[0] == TEXT('-')) ? -1 : 1;
+			FStringView Number = (Word[0] == TEXT('+') || Word[0] == TEXT('-')) ? Word.RightChop(1) : Word;
+
+			int64 Amount = 0;
+			const int32 NumDigits = ParseDigits(Number, Amount);
+			FStringView UnitWord = Number.RightChop(NumDigits);
+			if (UnitWord.IsEmpty())
+			{
+				UnitWord = NextWord(Remaining);
+			}
+
+			int64 Unit = 0;
+			if (NumDigits > 0 && FindKeyword(UnitWord, Units, Unit))
+			{
+				const FStep Step = MakeOffsetStep(Sign * Amount, Unit);
+				bSucceeded = AddStep(Step.Operation, Step.Value);
+			}
+			else if (ParseIso8601(Word, Value))
+			{
+				bSucceeded = AddStep(EOperation::SetDateTime, Value);
+			}
+		}
+		else if (ParseIso8601(Word, Value))
+		{
+			bSucceeded = AddStep(EOperation::SetDateTime, Value);
+		}
+
+		if (!bSucceeded)
+		{
+			return false;
+		}
+	}
+
+	if (Expression.IsEmpty())
+	{
+		return false;
+	}
+
+	OutExpression = Expression;
+	return true;
+}
+
+bool FPickableDateTimeQuickEntry::Evaluate(FStringView Text, const FDateTime& Reference, FDateTime& OutDateTime)
+{
+	FPickableDateTimeQuickEntry Expression;
+	return (Compile(Text, Expression) && Expression.Evaluate(Reference, OutDateTime));
+}
+
+bool FPickableDateTimeQuickEntry::Evaluate(const FDateTime& Reference, FDateTime& OutDateTime) const
+{
+	using namespace PickableDateTimeQuickEntryInternal;
+
+	const int64 MinTicks = FDateTime::MinValue().GetTicks();
+	const int64 MaxTicks = FDateTime::MaxValue().GetTicks();
+
+	int64 Ticks = Reference.GetTicks();
+	for (int32 StepIndex = 0; StepIndex < NumSteps; StepIndex++)
+	{
+		const FStep& Step = Steps[StepIndex];
+		switch (Step.Operation)
+		{
+		case EOperation::SetNow:
+			Ticks = FDateTime::Now().GetTicks();
+			break;
+		case EOperation::SetToday:
+			Ticks = FDateTime::Today().GetTicks() + GetTimeOfDayTicks(Ticks);
+			break;
+		case EOperation::SetDate:
+			Ticks = Step.Value + GetTimeOfDayTicks(Ticks);
+			break;
+		case EOperation::SetDateTime:
+			Ticks = Step.Value;
+			break;
+		case EOperation::AddTicks:
+			Ticks += Step.Value;
+			break;
+		case EOperation::AddDays:
+			Ticks += Step.Value * ETimespan::TicksPerDay;
+			break;
+		case EOperation::AddMonths:
+		{
+			// The number of months is limited by MaxDigits, so it fits in int32.
+			const int64 DayNumber = PickableDateTimeCalendar::AddMonths(GetDayNumber(Ticks), static_cast<int32>(Step.Value));
+			if (DayNumber < GetDayNumber(MinTicks) || DayNumber > GetDayNumber(MaxTicks))
+			{
+				return false;
+			}
+
+			Ticks = SetDayNumber(Ticks, DayNumber);
+			break;
+		}
+		case EOperation::NextWeekday:
+		{
+			const int64 NumDays = (Step.Value - PickableDateTimeCalendar::GetDayOfWeekIndex(GetDayNumber(Ticks)) + 7) % 7;
+			Ticks += ((NumDays == 0) ? 7 : NumDays) * ETimespan::TicksPerDay;
+			break;
+		}
+		case EOperation::OnOrAfterWeekday:
+			Ticks += ((Step.Value - PickableDateTimeCalendar::GetDayOfWeekIndex(GetDayNumber(Ticks)) + 7) % 7) * ETimespan::TicksPerDay;
+			break;
+		case EOperation::PreviousWeekday:
+		{
+			const int64 NumDays = (PickableDateTimeCalendar::GetDayOfWeekIndex(GetDayNumber(Ticks)) - Step.Value + 7) % 7;
+			Ticks -= ((NumDays == 0) ? 7 : NumDays) * ETimespan::TicksPerDay;
+			break;
+		}
+		case EOperation::StartOfWeek:
+			Ticks = SetDayNumber(Ticks, PickableDateTimeCalendar::StartOfWeek(GetDayNumber(Ticks)));
+			break;
+		case EOperation::EndOfWeek:
+			Ticks = SetDayNumber(Ticks, PickableDateTimeCalendar::StartOfWeek(GetDayNumber(Ticks)) + 6);
+			break;
+		case EOperation::StartOfMonth:
+			Ticks = SetDayNumber(Ticks, PickableDateTimeCalendar::StartOfMonth(GetDayNumber(Ticks)));
+			break;
+		case EOperation::EndOfMonth:
+			Ticks = SetDayNumber(Ticks, PickableDateTimeCalendar::AddMonths(PickableDateTimeCalendar::StartOfMonth(GetDayNumber(Ticks)), 1) - 1);
+			break;
+		case EOperation::StartOfYear:
+			Ticks = SetDayNumber(Ticks, PickableDateTimeCalendar::StartOfYear(GetDayNumber(Ticks)));
+			break;
+		case EOperation::EndOfYear:
+			Ticks = SetDayNumber(Ticks, PickableDateTimeCalendar::AddMonths(PickableDateTimeCalendar::StartOfYear(GetDayNumber(Ticks)), 12) - 1);
+			break;
+		default:
+			checkNoEntry();
+			return false;
+		}
+
+		if (Ticks < MinTicks || Ticks > MaxTicks)
+		{
+			return false;
+		}
+	}
+
+	OutDateTime = FDateTime(Ticks);
+	return true;
+}
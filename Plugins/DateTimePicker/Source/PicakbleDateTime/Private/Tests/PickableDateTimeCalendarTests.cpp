@@ -0,0 +1,286 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "PickableDateTimeCalendar.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace PickableDateTimeCalendarTestsInternal
+{
+	// The day number of the last day that FDateTime can represent.
+	static int64 GetMaxDayNumber()
+	{
+		return PickableDateTimeCalendar::ToDayNumber(FDateTime::MaxValue());
+	}
+
+	// Formats a day number for error messages.
+	static FString DayToString(int64 DayNumber)
+	{
+		return PickableDateTimeCalendar::FromDayNumber(DayNumber).ToString(TEXT("%Y-%m-%d"));
+	}
+
+	// Compares dates through their ISO-8601 text so that a failure shows both values.
+	static bool TestDateTime(FAutomationTestBase& Test, const TCHAR* What, const FDateTime& Actual, const FDateTime& Expected)
+	{
+		return Test.TestEqual(What, Actual.ToIso8601(), Expected.ToIso8601());
+	}
+
+	// Collects the failures of a check that runs over many days, reporting only the first one in detail.
+	struct FFailureCounter
+	{
+	public:
+		explicit FFailureCounter(FAutomationTestBase& InTest) : Test(InTest) {}
+
+		void Add(const FString& Message)
+		{
+			if (NumFailures++ == 0)
+			{
+				Test.AddError(Message);
+			}
+		}
+
+		bool Finish(const TCHAR* What)
+		{
+			if (NumFailures > 1)
+			{
+				Test.AddError(FString::Printf(TEXT("%s failed for %lld days in total."), What, NumFailures));
+			}
+			return (NumFailures == 0);
+		}
+
+	private:
+		FAutomationTestBase& Test;
+		int64 NumFailures = 0;
+	};
+
+	// Returns the day number of the Monday of ISO week 1 of the year, which is the week containing January 4.
+	static int64 GetFirstIsoWeekStart(int32 Year)
+	{
+		return PickableDateTimeCalendar::StartOfWeek(PickableDateTimeCalendar::DaysFromCivil(Year, 1, 4));
+	}
+
+	// Steps one business day at a time, as the reference for AddBusinessDays.
+	static int64 StepBusinessDays(int64 DayNumber, int32 NumBusinessDays)
+	{
+		const int32 Direction = (NumBusinessDays >= 0) ? 1 : -1;
+		for (int32 Step = 0; Step != NumBusinessDays; Step += Direction)
+		{
+			do
+			{
+				DayNumber += Direction;
+			}
+			while (!PickableDateTimeCalendar::IsBusinessDay(DayNumber));
+		}
+		return DayNumber;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPickableDateTimeCalendarCivilRoundTripTest, "DateTimePicker.Calendar.CivilRoundTrip", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FPickableDateTimeCalendarCivilRoundTripTest::RunTest(const FString& Parameters)
+{
+	using namespace PickableDateTimeCalendarTestsInternal;
+
+	// Compare every day that FDateTime can represent with its own calendar.
+	FFailureCounter Failures(*this);
+	const int64 MaxDayNumber = GetMaxDayNumber();
+	for (int64 DayNumber = 0; DayNumber <= MaxDayNumber; DayNumber++)
+	{
+		const FDateTime DateTime = PickableDateTimeCalendar::FromDayNumber(DayNumber);
+
+		int32 ExpectedYear = 0, ExpectedMonth = 0, ExpectedDay = 0;
+		DateTime.GetDate(ExpectedYear, ExpectedMonth, ExpectedDay);
+
+		int32 Year = 0, Month = 0, Day = 0;
+		PickableDateTimeCalendar::CivilFromDays(DayNumber, Year, Month, Day);
+		if (Year != ExpectedYear || Month != ExpectedMonth || Day != ExpectedDay)
+		{
+			Failures.Add(FString::Printf(TEXT("CivilFromDays(%lld) returned %04d-%02d-%02d, expected %s."), DayNumber, Year, Month, Day, *DayToString(DayNumber)));
+			continue;
+		}
+
+		const int64 RoundTrip = PickableDateTimeCalendar::DaysFromCivil(Year, Month, Day);
+		if (RoundTrip != DayNumber || RoundTrip != PickableDateTimeCalendar::ToDayNumber(FDateTime(Year, Month, Day)))
+		{
+			Failures.Add(FString::Printf(TEXT("DaysFromCivil(%s) returned %lld, expected %lld."), *DayToString(DayNumber), RoundTrip, DayNumber));
+			continue;
+		}
+
+		if (PickableDateTimeCalendar::GetDayOfWeekIndex(DayNumber) != static_cast<int32>(DateTime.GetDayOfWeek()))
+		{
+			Failures.Add(FString::Printf(TEXT("GetDayOfWeekIndex(%s) doesn't match FDateTime::GetDayOfWeek."), *DayToString(DayNumber)));
+		}
+	}
+
+	// The time of day is kept by the FDateTime wrappers.
+	const FDateTime Noon(2024, 2, 29, 12, 34, 56, 789);
+	TestDateTime(*this, TEXT("FromDayNumber keeps the time of day"), PickableDateTimeCalendar::FromDayNumber(PickableDateTimeCalendar::ToDayNumber(Noon), PickableDateTimeCalendar::GetTimeOfDayTicks(Noon)), Noon);
+
+	return Failures.Finish(TEXT("The civil round trip"));
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPickableDateTimeCalendarAddMonthsTest, "DateTimePicker.Calendar.AddMonths", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FPickableDateTimeCalendarAddMonthsTest::RunTest(const FString& Parameters)
+{
+	using namespace PickableDateTimeCalendarTestsInternal;
+
+	// The day is clamped to the length of the resulting month.
+	TestDateTime(*this, TEXT("2024-01-31 + 1 month"), PickableDateTimeCalendar::AddMonths(FDateTime(2024, 1, 31), 1), FDateTime(2024, 2, 29));
+	TestDateTime(*this, TEXT("2023-01-31 + 1 month"), PickableDateTimeCalendar::AddMonths(FDateTime(2023, 1, 31), 1), FDateTime(2023, 2, 28));
+	TestDateTime(*this, TEXT("2024-03-31 - 1 month"), PickableDateTimeCalendar::AddMonths(FDateTime(2024, 3, 31), -1), FDateTime(2024, 2, 29));
+	TestDateTime(*this, TEXT("2024-08-31 + 1 month"), PickableDateTimeCalendar::AddMonths(FDateTime(2024, 8, 31), 1), FDateTime(2024, 9, 30));
+	TestDateTime(*this, TEXT("2023-12-31 + 2 months"), PickableDateTimeCalendar::AddMonths(FDateTime(2023, 12, 31), 2), FDateTime(2024, 2, 29));
+	TestDateTime(*this, TEXT("2024-03-31 - 13 months"), PickableDateTimeCalendar::AddMonths(FDateTime(2024, 3, 31), -13), FDateTime(2023, 2, 28));
+	TestDateTime(*this, TEXT("2024-02-29 + 12 months"), PickableDateTimeCalendar::AddMonths(FDateTime(2024, 2, 29), 12), FDateTime(2025, 2, 28));
+	TestDateTime(*this, TEXT("2024-02-29 + 48 months"), PickableDateTimeCalendar::AddMonths(FDateTime(2024, 2, 29), 48), FDateTime(2028, 2, 29));
+	TestDateTime(*this, TEXT("2024-01-15 10:30 + 1 month keeps the time"), PickableDateTimeCalendar::AddMonths(FDateTime(2024, 1, 15, 10, 30), 1), FDateTime(2024, 2, 15, 10, 30));
+
+	// Compare with the month arithmetic of FDateTime over two centuries, including every month end and leap year rule.
+	FFailureCounter Failures(*this);
+	const int64 FirstDayNumber = PickableDateTimeCalendar::DaysFromCivil(1900, 1, 1);
+	const int64 LastDayNumber = PickableDateTimeCalendar::DaysFromCivil(2100, 12, 31);
+	for (int64 DayNumber = FirstDayNumber; DayNumber <= LastDayNumber; DayNumber++)
+	{
+		int32 Year = 0, Month = 0, Day = 0;
+		PickableDateTimeCalendar::FromDayNumber(DayNumber).GetDate(Year, Month, Day);
+
+		for (int32 NumMonths = -25; NumMonths <= 25; NumMonths++)
+		{
+			const int32 TotalMonths = (Year * 12) + (Month - 1) + NumMonths;
+			const int32 ExpectedYear = TotalMonths / 12;
+			const int32 ExpectedMonth = (TotalMonths % 12) + 1;
+			const int32 ExpectedDay = FMath::Min(Day, FDateTime::DaysInMonth(ExpectedYear, ExpectedMonth));
+			const FDateTime Expected(ExpectedYear, ExpectedMonth, ExpectedDay);
+
+			const int64 Result = PickableDateTimeCalendar::AddMonths(DayNumber, NumMonths);
+			if (Result != PickableDateTimeCalendar::ToDayNumber(Expected))
+			{
+				Failures.Add(FString::Printf(TEXT("AddMonths(%s, %d) returned %s, expected %s."), *DayToString(DayNumber), NumMonths, *DayToString(Result), *Expected.ToString(TEXT("%Y-%m-%d"))));
+			}
+		}
+	}
+
+	return Failures.Finish(TEXT("AddMonths"));
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPickableDateTimeCalendarIsoWeekTest, "DateTimePicker.Calendar.IsoWeek", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FPickableDateTimeCalendarIsoWeekTest::RunTest(const FString& Parameters)
+{
+	using namespace PickableDateTimeCalendarTestsInternal;
+
+	// Weeks around the turn of the year, where the week year differs from the calendar year.
+	struct FCase
+	{
+		int32 Year, Month, Day;
+		int32 WeekYear, Week;
+	};
+	static const FCase Cases[] =
+	{
+		{ 2015, 12, 31, 2015, 53 },
+		{ 2016, 1, 3, 2015, 53 },
+		{ 2016, 1, 4, 2016, 1 },
+		{ 2018, 12, 31, 2019, 1 },
+		{ 2020, 12, 31, 2020, 53 },
+		{ 2021, 1, 1, 2020, 53 },
+		{ 2021, 1, 3, 2020, 53 },
+		{ 2021, 1, 4, 2021, 1 },
+		{ 2021, 12, 31, 2021, 52 },
+		{ 2022, 1, 2, 2021, 52 },
+		{ 2024, 12, 29, 2024, 52 },
+		{ 2024, 12, 30, 2025, 1 },
+		{ 2026, 12, 31, 2026, 53 },
+		{ 2027, 1, 3, 2026, 53 },
+		{ 2027, 1, 4, 2027, 1 },
+	};
+	for (const FCase& Case : Cases)
+	{
+		int32 WeekYear = 0;
+		const int32 Week = PickableDateTimeCalendar::GetIsoWeek(PickableDateTimeCalendar::DaysFromCivil(Case.Year, Case.Month, Case.Day), WeekYear);
+		const FString What = FString::Printf(TEXT("ISO week of %04d-%02d-%02d"), Case.Year, Case.Month, Case.Day);
+		TestEqual(*What, Week, Case.Week);
+		TestEqual(*(What + TEXT(" (week year)")), WeekYear, Case.WeekYear);
+	}
+
+	// Compare every day with the definition that week 1 is the week containing January 4.
+	FFailureCounter Failures(*this);
+	const int64 MaxDayNumber = GetMaxDayNumber();
+	for (int64 DayNumber = 0; DayNumber <= MaxDayNumber; DayNumber++)
+	{
+		int32 Year = 0, Month = 0, Day = 0;
+		PickableDateTimeCalendar::CivilFromDays(DayNumber, Year, Month, Day);
+
+		int32 ExpectedWeekYear = Year;
+		if (DayNumber < GetFirstIsoWeekStart(Year))
+		{
+			ExpectedWeekYear = Year - 1;
+		}
+		else if (DayNumber >= GetFirstIsoWeekStart(Year + 1))
+		{
+			ExpectedWeekYear = Year + 1;
+		}
+		const int32 ExpectedWeek = static_cast<int32>((DayNumber - GetFirstIsoWeekStart(ExpectedWeekYear)) / 7) + 1;
+
+		int32 WeekYear = 0;
+		const int32 Week = PickableDateTimeCalendar::GetIsoWeek(DayNumber, WeekYear);
+		if (Week != ExpectedWeek || WeekYear != ExpectedWeekYear)
+		{
+			Failures.Add(FString::Printf(TEXT("GetIsoWeek(%s) returned week %d of %d, expected week %d of %d."), *DayToString(DayNumber), Week, WeekYear, ExpectedWeek, ExpectedWeekYear));
+		}
+	}
+
+	// A year has 53 weeks exactly when it starts on a Thursday, or on a Wednesday in a leap year.
+	for (int32 Year = 1; Year < 9999; Year++)
+	{
+		int32 WeekYear = 0;
+		const int32 LastWeek = PickableDateTimeCalendar::GetIsoWeek(GetFirstIsoWeekStart(Year + 1) - 1, WeekYear);
+		const int32 FirstDayOfWeekIndex = PickableDateTimeCalendar::GetDayOfWeekIndex(PickableDateTimeCalendar::DaysFromCivil(Year, 1, 1));
+		const bool bExpectLongYear = (FirstDayOfWeekIndex == 3) || (FirstDayOfWeekIndex == 2 && PickableDateTimeCalendar::IsLeapYear(Year));
+		if (LastWeek != (bExpectLongYear ? 53 : 52))
+		{
+			Failures.Add(FString::Printf(TEXT("The last ISO week of %d is %d, expected %d."), Year, LastWeek, bExpectLongYear ? 53 : 52));
+		}
+	}
+
+	return Failures.Finish(TEXT("GetIsoWeek"));
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPickableDateTimeCalendarAddBusinessDaysTest, "DateTimePicker.Calendar.AddBusinessDays", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FPickableDateTimeCalendarAddBusinessDaysTest::RunTest(const FString& Parameters)
+{
+	using namespace PickableDateTimeCalendarTestsInternal;
+
+	// January 5, 2024 is a Friday.
+	TestDateTime(*this, TEXT("Friday + 1"), PickableDateTimeCalendar::AddBusinessDays(FDateTime(2024, 1, 5), 1), FDateTime(2024, 1, 8));
+	TestDateTime(*this, TEXT("Monday - 1"), PickableDateTimeCalendar::AddBusinessDays(FDateTime(2024, 1, 8), -1), FDateTime(2024, 1, 5));
+	TestDateTime(*this, TEXT("Saturday + 1"), PickableDateTimeCalendar::AddBusinessDays(FDateTime(2024, 1, 6), 1), FDateTime(2024, 1, 8));
+	TestDateTime(*this, TEXT("Sunday - 1"), PickableDateTimeCalendar::AddBusinessDays(FDateTime(2024, 1, 7), -1), FDateTime(2024, 1, 5));
+	TestDateTime(*this, TEXT("Sunday + 5"), PickableDateTimeCalendar::AddBusinessDays(FDateTime(2024, 1, 7), 5), FDateTime(2024, 1, 12));
+	TestDateTime(*this, TEXT("Saturday - 5"), PickableDateTimeCalendar::AddBusinessDays(FDateTime(2024, 1, 6), -5), FDateTime(2024, 1, 1));
+	TestDateTime(*this, TEXT("Wednesday + 10"), PickableDateTimeCalendar::AddBusinessDays(FDateTime(2024, 1, 3), 10), FDateTime(2024, 1, 17));
+	TestDateTime(*this, TEXT("Wednesday - 10"), PickableDateTimeCalendar::AddBusinessDays(FDateTime(2024, 1, 17), -10), FDateTime(2024, 1, 3));
+	TestDateTime(*this, TEXT("Saturday + 0"), PickableDateTimeCalendar::AddBusinessDays(FDateTime(2024, 1, 6), 0), FDateTime(2024, 1, 6));
+	TestDateTime(*this, TEXT("Friday 18:00 + 1 keeps the time"), PickableDateTimeCalendar::AddBusinessDays(FDateTime(2024, 1, 5, 18), 1), FDateTime(2024, 1, 8, 18));
+
+	// Compare with stepping one day at a time in both directions, starting on every day of the week.
+	FFailureCounter Failures(*this);
+	const int64 FirstDayNumber = PickableDateTimeCalendar::DaysFromCivil(2023, 12, 1);
+	for (int64 DayNumber = FirstDayNumber; DayNumber < FirstDayNumber + 70; DayNumber++)
+	{
+		for (int32 NumBusinessDays = -60; NumBusinessDays <= 60; NumBusinessDays++)
+		{
+			const int64 Expected = (NumBusinessDays == 0) ? DayNumber : StepBusinessDays(DayNumber, NumBusinessDays);
+			const int64 Result = PickableDateTimeCalendar::AddBusinessDays(DayNumber, NumBusinessDays);
+			if (Result != Expected)
+			{
+				Failures.Add(FString::Printf(TEXT("AddBusinessDays(%s, %d) returned %s, expected %s."), *DayToString(DayNumber), NumBusinessDays, *DayToString(Result), *DayToString(Expected)));
+			}
+		}
+	}
+
+	return Failures.Finish(TEXT("AddBusinessDays"));
+}
+
+#endif
@@ -0,0 +1,168 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "PickableDateTimeConstraints.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace PickableDateTimeConstraintsTestsInternal
+{
+	// Compares dates through their ISO-8601 text so that a failure shows both values.
+	static bool TestDateTime(FAutomationTestBase& Test, const TCHAR* What, const FDateTime& Actual, const FDateTime& Expected)
+	{
+		return Test.TestEqual(What, Actual.ToIso8601(), Expected.ToIso8601());
+	}
+
+	// Creates constraints with a range and optionally without weekends.
+	static FPickableDateTimeConstraints MakeConstraints(const TOptional<FDateTime>& MinDate, const TOptional<FDateTime>& MaxDate, bool bDisallowWeekends)
+	{
+		FPickableDateTimeConstraints Constraints;
+		Constraints.MinDate = MinDate;
+		Constraints.MaxDate = MaxDate;
+		Constraints.bDisallowWeekends = bDisallowWeekends;
+		return Constraints;
+	}
+
+	// Finds the allowed day closest to the date by checking every day in the range, as the reference for TryClamp.
+	static bool FindClosestAllowedDay(const FPickableDateTimeConstraints& Constraints, const FDateTime& Date, FDateTime& OutDate)
+	{
+		bool bFound = false;
+		for (FDateTime Candidate = Constraints.MinDate.GetValue(); Candidate <= Constraints.MaxDate.GetValue(); Candidate += FTimespan::FromDays(1))
+		{
+			if (Constraints.IsAllowed(Candidate) && (!bFound || FMath::Abs((Candidate - Date).GetTicks()) < FMath::Abs((OutDate - Date).GetTicks())))
+			{
+				OutDate = Candidate;
+				bFound = true;
+			}
+		}
+		return bFound;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPickableDateTimeConstraintsClampTest, "DateTimePicker.Constraints.Clamp", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FPickableDateTimeConstraintsClampTest::RunTest(const FString& Parameters)
+{
+	using namespace PickableDateTimeConstraintsTestsInternal;
+
+	// 2024-01-05 is a Friday, 2024-01-06 a Saturday, 2024-01-07 a Sunday and 2024-01-08 a Monday.
+	const FPickableDateTimeConstraints Unconstrained;
+	TestDateTime(*this, TEXT("No constraints"), Unconstrained.Clamp(FDateTime(2024, 1, 6, 10, 30)), FDateTime(2024, 1, 6, 10, 30));
+
+	const FPickableDateTimeConstraints Range = MakeConstraints(FDateTime(2024, 1, 10), FDateTime(2024, 1, 20), false);
+	TestDateTime(*this, TEXT("Before MinDate"), Range.Clamp(FDateTime(2024, 1, 1, 10, 30)), FDateTime(2024, 1, 10, 10, 30));
+	TestDateTime(*this, TEXT("After MaxDate"), Range.Clamp(FDateTime(2024, 2, 1, 10, 30)), FDateTime(2024, 1, 20, 10, 30));
+	TestDateTime(*this, TEXT("Any time on MaxDate"), Range.Clamp(FDateTime(2024, 1, 20, 23, 59)), FDateTime(2024, 1, 20, 23, 59));
+	TestDateTime(*this, TEXT("In range"), Range.Clamp(FDateTime(2024, 1, 15, 10, 30)), FDateTime(2024, 1, 15, 10, 30));
+
+	const FPickableDateTimeConstraints NoWeekends = MakeConstraints({}, {}, true);
+	TestDateTime(*this, TEXT("Saturday moves to Friday"), NoWeekends.Clamp(FDateTime(2024, 1, 6, 10, 30)), FDateTime(2024, 1, 5, 10, 30));
+	TestDateTime(*this, TEXT("Sunday moves to Monday"), NoWeekends.Clamp(FDateTime(2024, 1, 7, 10, 30)), FDateTime(2024, 1, 8, 10, 30));
+	TestDateTime(*this, TEXT("Weekday is kept"), NoWeekends.Clamp(FDateTime(2024, 1, 5, 10, 30)), FDateTime(2024, 1, 5, 10, 30));
+
+	// The closer weekday is out of range, so the other one is used.
+	TestDateTime(*this, TEXT("Saturday on MinDate"), MakeConstraints(FDateTime(2024, 1, 6), {}, true).Clamp(FDateTime(2024, 1, 6)), FDateTime(2024, 1, 8));
+	TestDateTime(*this, TEXT("Sunday on MaxDate"), MakeConstraints({}, FDateTime(2024, 1, 7), true).Clamp(FDateTime(2024, 1, 7)), FDateTime(2024, 1, 5));
+	TestDateTime(*this, TEXT("After a MaxDate on Saturday"), MakeConstraints({}, FDateTime(2024, 1, 6), true).Clamp(FDateTime(2024, 2, 1)), FDateTime(2024, 1, 5));
+
+	// A range of only a weekend has no allowed date.
+	const FPickableDateTimeConstraints WeekendOnly = MakeConstraints(FDateTime(2024, 1, 6), FDateTime(2024, 1, 7), true);
+	FDateTime ClampedDateTime;
+	TestFalse(TEXT("TryClamp fails if no date is allowed"), WeekendOnly.TryClamp(FDateTime(2024, 1, 1, 10, 30), ClampedDateTime));
+	TestDateTime(*this, TEXT("TryClamp still moves into the range"), ClampedDateTime, FDateTime(2024, 1, 6, 10, 30));
+	TestFalse(TEXT("The result is not allowed"), WeekendOnly.IsAllowed(ClampedDateTime));
+
+	// Compare with checking every day of ranges starting on each day of the week.
+	int32 NumFailures = 0;
+	for (int32 MinDay = 1; MinDay <= 7; MinDay++)
+	{
+		for (int32 NumDays = 0; NumDays < 10; NumDays++)
+		{
+			const FPickableDateTimeConstraints Constraints = MakeConstraints(FDateTime(2024, 1, MinDay), FDateTime(2024, 1, MinDay + NumDays), true);
+			for (FDateTime Date = FDateTime(2023, 12, 25); Date < FDateTime(2024, 1, 25); Date += FTimespan::FromDays(1))
+			{
+				FDateTime Expected;
+				const bool bExpected = FindClosestAllowedDay(Constraints, Date, Expected);
+				const bool bResult = Constraints.TryClamp(Date + FTimespan::FromHours(6), ClampedDateTime);
+				if (bResult != bExpected || (bResult && ClampedDateTime != Expected + FTimespan::FromHours(6)))
+				{
+					if (NumFailures++ == 0)
+					{
+						AddError(FString::Printf(TEXT("TryClamp(%s) in [%s, %s] returned %s, expected %s."),
+							*Date.ToString(TEXT("%Y-%m-%d")),
+							*Constraints.MinDate.GetValue().ToString(TEXT("%Y-%m-%d")),
+							*Constraints.MaxDate.GetValue().ToString(TEXT("%Y-%m-%d")),
+							bResult ? *ClampedDateTime.ToString(TEXT("%Y-%m-%d")) : TEXT("false"),
+							bExpected ? *Expected.ToString(TEXT("%Y-%m-%d")) : TEXT("false")
+						));
+					}
+				}
+			}
+		}
+	}
+
+	return (NumFailures == 0);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPickableDateTimeConstraintsValidateTest, "DateTimePicker.Constraints.Validate", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FPickableDateTimeConstraintsValidateTest::RunTest(const FString& Parameters)
+{
+	using namespace PickableDateTimeConstraintsTestsInternal;
+
+	const TArray<FDateTime> DateTimes =
+	{
+		FDateTime(2024, 1, 9, 10, 30),	// Before MinDate.
+		FDateTime(2024, 1, 10),			// MinDate.
+		FDateTime(2024, 1, 13),			// Saturday.
+		FDateTime(2024, 1, 15, 12),		// Monday.
+		FDateTime(2024, 1, 19, 23, 59),	// Any time on MaxDate.
+		FDateTime(2024, 1, 20),			// After MaxDate.
+	};
+	const TArray<int32> ExpectedInvalidIndices = { 0, 2, 5 };
+
+	TArray<FPickableDateTime> Values;
+	for (const FDateTime& DateTime : DateTimes)
+	{
+		Values.Add(FPickableDateTime(DateTime));
+	}
+
+	const FPickableDateTimeConstraints Constraints = MakeConstraints(FDateTime(2024, 1, 10), FDateTime(2024, 1, 19), true);
+
+	TArray<int32> InvalidIndices;
+	TestFalse(TEXT("Validate fails for FDateTime"), Constraints.Validate(DateTimes, InvalidIndices));
+	TestTrue(TEXT("Invalid indices of FDateTime"), InvalidIndices == ExpectedInvalidIndices);
+
+	InvalidIndices.Reset();
+	TestFalse(TEXT("Validate fails for FPickableDateTime"), Constraints.Validate(Values, InvalidIndices));
+	TestTrue(TEXT("Invalid indices of FPickableDateTime"), InvalidIndices == ExpectedInvalidIndices);
+
+	// Indices are appended, and the result only reflects the values of this call.
+	InvalidIndices = { 100 };
+	TestTrue(TEXT("Validate succeeds for allowed values"), Constraints.Validate(MakeArrayView(DateTimes).Slice(1, 1), InvalidIndices));
+	TestTrue(TEXT("Existing indices are kept"), InvalidIndices == TArray<int32>({ 100 }));
+
+	InvalidIndices.Reset();
+	TestTrue(TEXT("Unconstrained values are all valid"), FPickableDateTimeConstraints().Validate(DateTimes, InvalidIndices));
+	TestEqual(TEXT("No invalid indices without constraints"), InvalidIndices.Num(), 0);
+
+	// The disabled cells of the day mode calendar grid are exactly the days that Validate rejects.
+	int32 NumMismatches = 0;
+	const FDateTime FirstGridDate(2024, 1, 1);
+	const uint64 DisabledMask = Constraints.GetDisabledDayMask(FirstGridDate);
+	for (int32 Cell = 0; Cell < FPickableDateTimeConstraints::NumDayGridCells; Cell++)
+	{
+		const FDateTime Date = FirstGridDate + FTimespan::FromDays(Cell);
+		const bool bDisabled = ((DisabledMask >> Cell) & 1) != 0;
+		InvalidIndices.Reset();
+		if (bDisabled == Constraints.Validate(MakeArrayView(&Date, 1), InvalidIndices) || bDisabled == Constraints.IsAllowed(Date))
+		{
+			NumMismatches++;
+		}
+	}
+	TestEqual(TEXT("Cells whose disabled bit disagrees with Validate"), NumMismatches, 0);
+
+	return true;
+}
+
+#endif
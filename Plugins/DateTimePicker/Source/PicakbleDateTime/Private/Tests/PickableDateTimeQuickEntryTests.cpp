@@ -0,0 +1,187 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "PickableDateTimeQuickEntry.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace PickableDateTimeQuickEntryTestsInternal
+{
+	// The reference of all expressions, a Wednesday.
+	static const FDateTime Reference(2024, 1, 10, 10, 30);
+
+	// Evaluates the expression and compares the result through its ISO-8601 text so that a failure shows both values.
+	static bool TestEvaluate(FAutomationTestBase& Test, const TCHAR* Text, const FDateTime& Expected, const FDateTime& InReference = Reference)
+	{
+		FDateTime Result;
+		if (!FPickableDateTimeQuickEntry::Evaluate(Text, InReference, Result))
+		{
+			Test.AddError(FString::Printf(TEXT("\"%s\" failed to evaluate, expected %s."), Text, *Expected.ToIso8601()));
+			return false;
+		}
+
+		return Test.TestEqual(FString::Printf(TEXT("\"%s\""), Text), Result.ToIso8601(), Expected.ToIso8601());
+	}
+
+	// Checks that the expression does not compile.
+	static bool TestInvalid(FAutomationTestBase& Test, const TCHAR* Text)
+	{
+		FPickableDateTimeQuickEntry Expression;
+		return Test.TestFalse(FString::Printf(TEXT("\"%s\" is rejected"), Text), FPickableDateTimeQuickEntry::Compile(Text, Expression));
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPickableDateTimeQuickEntryDateLiteralTest, "DateTimePicker.QuickEntry.DateLiteral", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FPickableDateTimeQuickEntryDateLiteralTest::RunTest(const FString& Parameters)
+{
+	using namespace PickableDateTimeQuickEntryTestsInternal;
+
+	// Date literals keep the time of day of the reference.
+	TestEvaluate(*this, TEXT("2025"), FDateTime(2025, 1, 1, 10, 30));
+	TestEvaluate(*this, TEXT("2025-06"), FDateTime(2025, 6, 1, 10, 30));
+	TestEvaluate(*this, TEXT("2025-06-15"), FDateTime(2025, 6, 15, 10, 30));
+	TestEvaluate(*this, TEXT("2024-02-29"), FDateTime(2024, 2, 29, 10, 30));
+
+	// A four digit number followed by a unit is an offset rather than a year.
+	TestEvaluate(*this, TEXT("1000 days"), FDateTime(2026, 10, 6, 10, 30));
+
+	// Invalid dates are not accepted by the ISO-8601 fallback either.
+	TestInvalid(*this, TEXT("2025-13"));
+	TestInvalid(*this, TEXT("2025-02-30"));
+	TestInvalid(*this, TEXT("2023-02-29"));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPickableDateTimeQuickEntryOffsetTest, "DateTimePicker.QuickEntry.Offset", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FPickableDateTimeQuickEntryOffsetTest::RunTest(const FString& Parameters)
+{
+	using namespace PickableDateTimeQuickEntryTestsInternal;
+
+	TestEvaluate(*this, TEXT("+3d"), FDateTime(2024, 1, 13, 10, 30));
+	TestEvaluate(*this, TEXT("-2w"), FDateTime(2023, 12, 27, 10, 30));
+	TestEvaluate(*this, TEXT("+1m"), FDateTime(2024, 2, 10, 10, 30));
+	TestEvaluate(*this, TEXT("-1y"), FDateTime(2023, 1, 10, 10, 30));
+	TestEvaluate(*this, TEXT("+4h"), FDateTime(2024, 1, 10, 14, 30));
+	TestEvaluate(*this, TEXT("-45min"), FDateTime(2024, 1, 10, 9, 45));
+
+	// Numbers without a sign and units in a separate word.
+	TestEvaluate(*this, TEXT("3 days"), FDateTime(2024, 1, 13, 10, 30));
+	TestEvaluate(*this, TEXT("-2 weeks"), FDateTime(2023, 12, 27, 10, 30));
+	TestEvaluate(*this, TEXT("+1 Month"), FDateTime(2024, 2, 10, 10, 30));
+
+	// Months are added on the calendar and clamped to the end of the month.
+	TestEvaluate(*this, TEXT("+1m"), FDateTime(2024, 2, 29, 8), FDateTime(2024, 1, 31, 8));
+	TestEvaluate(*this, TEXT("+1y"), FDateTime(2025, 2, 28, 8), FDateTime(2024, 2, 29, 8));
+
+	// Terms are applied from left to right.
+	TestEvaluate(*this, TEXT("+1d +2h -1w"), FDateTime(2024, 1, 4, 12, 30));
+
+	// Numbers are limited to MaxDigits so that no offset overflows the ticks.
+	TestEvaluate(*this, TEXT("+999999d"), FDateTime(4761, 12, 6, 10, 30));
+	TestInvalid(*this, TEXT("+1000000d"));
+	TestInvalid(*this, TEXT("+9999999999999999999d"));
+
+	// Offsets that compile but leave the range of FDateTime fail to evaluate.
+	FPickableDateTimeQuickEntry Expression;
+	FDateTime Result;
+	TestTrue(TEXT("\"+999999w\" compiles"), FPickableDateTimeQuickEntry::Compile(TEXT("+999999w"), Expression));
+	TestFalse(TEXT("\"+999999w\" is out of range"), Expression.Evaluate(Reference, Result));
+	TestFalse(TEXT("\"+999999y\" is out of range"), FPickableDateTimeQuickEntry::Evaluate(TEXT("+999999y"), Reference, Result));
+	TestFalse(TEXT("\"-999999d\" is out of range"), FPickableDateTimeQuickEntry::Evaluate(TEXT("-999999d"), Reference, Result));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPickableDateTimeQuickEntryKeywordTest, "DateTimePicker.QuickEntry.Keyword", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FPickableDateTimeQuickEntryKeywordTest::RunTest(const FString& Parameters)
+{
+	using namespace PickableDateTimeQuickEntryTestsInternal;
+
+	// Weekdays are on or after the reference, "next" is strictly after and "last" is strictly before.
+	TestEvaluate(*this, TEXT("fri"), FDateTime(2024, 1, 12, 10, 30));
+	TestEvaluate(*this, TEXT("wed"), FDateTime(2024, 1, 10, 10, 30));
+	TestEvaluate(*this, TEXT("Monday"), FDateTime(2024, 1, 15, 10, 30));
+	TestEvaluate(*this, TEXT("next wed"), FDateTime(2024, 1, 17, 10, 30));
+	TestEvaluate(*this, TEXT("next fri"), FDateTime(2024, 1, 12, 10, 30));
+	TestEvaluate(*this, TEXT("last wed"), FDateTime(2024, 1, 3, 10, 30));
+	TestEvaluate(*this, TEXT("LAST sun"), FDateTime(2024, 1, 7, 10, 30));
+
+	// Boundaries of the week (starting on Monday), the month and the year.
+	TestEvaluate(*this, TEXT("sow"), FDateTime(2024, 1, 8, 10, 30));
+	TestEvaluate(*this, TEXT("eow"), FDateTime(2024, 1, 14, 10, 30));
+	TestEvaluate(*this, TEXT("som"), FDateTime(2024, 1, 1, 10, 30));
+	TestEvaluate(*this, TEXT("eom"), FDateTime(2024, 1, 31, 10, 30));
+	TestEvaluate(*this, TEXT("soy"), FDateTime(2024, 1, 1, 10, 30));
+	TestEvaluate(*this, TEXT("eoy"), FDateTime(2024, 12, 31, 10, 30));
+	TestEvaluate(*this, TEXT("eom -1w"), FDateTime(2024, 1, 24, 10, 30));
+	TestEvaluate(*this, TEXT("2024-02 eom"), FDateTime(2024, 2, 29, 10, 30));
+
+	// Anchors relative to the current date keep the time of day of the reference.
+	const FDateTime Today = FDateTime::Today() + Reference.GetTimeOfDay();
+	TestEvaluate(*this, TEXT("today"), Today);
+	TestEvaluate(*this, TEXT("tomorrow"), Today + FTimespan::FromDays(1));
+	TestEvaluate(*this, TEXT("Yesterday"), Today - FTimespan::FromDays(1));
+	TestEvaluate(*this, TEXT("today +3d"), Today + FTimespan::FromDays(3));
+
+	FDateTime Now;
+	TestTrue(TEXT("\"now\" evaluates"), FPickableDateTimeQuickEntry::Evaluate(TEXT("now"), Reference, Now));
+	TestTrue(TEXT("\"now\" is the current time"), FMath::Abs((Now - FDateTime::Now()).GetTotalSeconds()) < 60.);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPickableDateTimeQuickEntryIso8601Test, "DateTimePicker.QuickEntry.Iso8601", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FPickableDateTimeQuickEntryIso8601Test::RunTest(const FString& Parameters)
+{
+	using namespace PickableDateTimeQuickEntryTestsInternal;
+
+	// Anything that is not a date literal or an offset falls back to ISO-8601, which sets the time of day too.
+	TestEvaluate(*this, TEXT("2025-06-15T12:30:00Z"), FDateTime(2025, 6, 15, 12, 30));
+	TestEvaluate(*this, TEXT("2025-06-15T12:30:00.123Z"), FDateTime(2025, 6, 15, 12, 30, 0, 123));
+	TestEvaluate(*this, TEXT("2025-06-15T12:30:00Z +1d"), FDateTime(2025, 6, 16, 12, 30));
+
+	TestInvalid(*this, TEXT("2025-06-15T25:00:00Z"));
+	TestInvalid(*this, TEXT("2025-06-15T12:60:00Z"));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPickableDateTimeQuickEntryInvalidTest, "DateTimePicker.QuickEntry.Invalid", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FPickableDateTimeQuickEntryInvalidTest::RunTest(const FString& Parameters)
+{
+	using namespace PickableDateTimeQuickEntryTestsInternal;
+
+	TestInvalid(*this, TEXT(""));
+	TestInvalid(*this, TEXT("   "));
+	TestInvalid(*this, TEXT("foo"));
+	TestInvalid(*this, TEXT("+d"));
+	TestInvalid(*this, TEXT("+3"));
+	TestInvalid(*this, TEXT("+3x"));
+	TestInvalid(*this, TEXT("3 foo"));
+	TestInvalid(*this, TEXT("next"));
+	TestInvalid(*this, TEXT("next foo"));
+	TestInvalid(*this, TEXT("last month"));
+	TestInvalid(*this, TEXT("eom foo"));
+
+	// An expression has at most MaxSteps operations, and "tomorrow" compiles to two of them.
+	FPickableDateTimeQuickEntry Expression;
+	TestTrue(TEXT("MaxSteps terms compile"), FPickableDateTimeQuickEntry::Compile(TEXT("+1d +1d +1d +1d +1d +1d +1d +1d"), Expression));
+	TestInvalid(*this, TEXT("+1d +1d +1d +1d +1d +1d +1d +1d +1d"));
+	TestInvalid(*this, TEXT("tomorrow +1d +1d +1d +1d +1d +1d +1d"));
+
+	// A failed compile leaves the previous expression untouched.
+	FDateTime Result;
+	TestFalse(TEXT("A failed compile returns false"), FPickableDateTimeQuickEntry::Compile(TEXT("foo"), Expression));
+	TestTrue(TEXT("The previous expression still evaluates"), Expression.Evaluate(Reference, Result));
+	TestEqual(TEXT("The previous expression is kept"), Result.ToIso8601(), FDateTime(2024, 1, 18, 10, 30).ToIso8601());
+
+	return true;
+}
+
+#endif
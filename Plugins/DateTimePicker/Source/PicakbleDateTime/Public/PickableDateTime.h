@@ -25,6 +25,10 @@ public:
 	explicit FPickableDateTime(const FDateTime& InDateTime) : DateTime(InDateTime) {}
 	virtual ~FPickableDateTime() = default;
 
+	// Imports the date and time directly from text such as ISO-8601, epoch seconds and ticks.
+	// Text in the struct format, such as (DateTime=...), is left to the generic struct import.
+	PICKABLEDATETIME_API bool ImportTextItem(const TCHAR*& Buffer, int32 PortFlags, UObject* Parent, FOutputDevice* ErrorText);
+
 	// FDateTime operator overloading wrapper functions.
 	// See the header of FDateTime for details.
 	FPickableDateTime operator+(const FTimespan& Other) const
@@ -94,8 +98,33 @@ public:
 	}
 };
 
+template<>
+struct TStructOpsTypeTraits<FPickableDateTime> : public TStructOpsTypeTraitsBase2<FPickableDateTime>
+{
+	enum
+	{
+		WithImportTextItem = true,
+	};
+};
+
+namespace PickableDateTimeHash
+{
+	// Mixes all the bits of the ticks with the 64-bit finalizer of MurmurHash3.
+	// Sequential ticks that differ only in the lower bits are spread evenly over the hash buckets.
+	FORCEINLINE uint32 MixTicks(int64 Ticks)
+	{
+		uint64 Hash = static_cast<uint64>(Ticks);
+		Hash ^= Hash >> 33;
+		Hash *= 0xff51afd7ed558ccdull;
+		Hash ^= Hash >> 33;
+		Hash *= 0xc4ceb9fe1a85ec53ull;
+		Hash ^= Hash >> 33;
+		return static_cast<uint32>(Hash);
+	}
+}
+
 // Define a GetTypeHash function so that it can be used as a map key.
 FORCEINLINE uint32 GetTypeHash(const FPickableDateTime& PickableDateTime)
 {
-	return GetTypeHash(PickableDateTime.DateTime);
+	return PickableDateTimeHash::MixTicks(PickableDateTime.DateTime.GetTicks());
 }
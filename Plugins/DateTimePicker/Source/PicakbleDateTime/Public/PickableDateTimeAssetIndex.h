@@ -0,0 +1,133 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/SoftObjectPath.h"
+#include "PickableDateTimeAssetTags.h"
+
+#if WITH_EDITOR
+class UPackage;
+class FObjectPostSaveContext;
+
+/**
+ * In-memory index of the values exported by FPickableDateTimeAssetTags, sorted by date and time.
+ * It is built from the Asset Registry on first use and kept up to date as assets are saved, renamed and deleted,
+ * so a range query over all assets takes O(log N + M) and never loads packages.
+ * The entries of each asset are found by binary search, so updating an asset with K values takes O(K log N) comparisons
+ * plus one move of the entries after the first changed position, instead of a scan of the whole index.
+ * Only available in the editor. Once built, it can be queried from any thread.
+ */
+class PICKABLEDATETIME_API FPickableDateTimeAssetIndex
+{
+public:
+	// A value found by a query.
+	struct FResult
+	{
+		FSoftObjectPath AssetPath;
+		FName TagName;
+		FDateTime DateTime;
+	};
+
+public:
+	// Returns the index, building it on first use. The first call must be made from the game thread.
+	static FPickableDateTimeAssetIndex& Get();
+
+	// Stops tracking the changes of assets and discards the index.
+	static void Shutdown();
+
+	// Destructor.
+	~FPickableDateTimeAssetIndex();
+
+	// Finds the values in [First, Last] in chronological order. If TagName is None, values of all tags are found.
+	void QueryRange(const FDateTime& First, const FDateTime& Last, TArray<FResult>& OutResults, FName TagName = NAME_None) const;
+
+	// Finds the assets that have at least one value in [First, Last], in the order of their earliest value in the range.
+	void QueryAssetsInRange(const FDateTime& First, const FDateTime& Last, TArray<FSoftObjectPath>& OutAssetPaths, FName TagName = NAME_None) const;
+
+	// Replaces the values of the asset.
+	void UpdateAsset(const FSoftObjectPath& AssetPath, TConstArrayView<FPickableDateTimeAssetTags::FValue> Values);
+
+	// Removes the values of the asset.
+	void RemoveAsset(const FSoftObjectPath& AssetPath);
+
+	// Discards the index and builds it again from all assets in the Asset Registry.
+	void Rebuild();
+
+	// Returns the number of values in the index.
+	int32 GetNumValues() const;
+
+	// Returns the number of assets that have at least one value.
+	int32 GetNumAssets() const;
+
+private:
+	// A value in the index. Entries are ordered by ticks and then by asset, so the entries of an asset can be found by binary search.
+	struct FEntry
+	{
+		int64 Ticks;
+		int32 AssetIndex;
+		int32 TagIndex;
+
+		bool operator<(const FEntry& Other) const
+		{
+			return (Ticks != Other.Ticks) ? (Ticks < Other.Ticks) : (AssetIndex < Other.AssetIndex);
+		}
+	};
+
+	// Binds-Unbinds the events of the Asset Registry and of saving packages.
+	void BindEvents();
+	void UnbindEvents();
+
+	// Called when an asset is discovered or its tags are updated by the Asset Registry.
+	void HandleOnAssetAddedOrUpdated(const FAssetData& AssetData);
+
+	// Called when an asset is deleted.
+	void HandleOnAssetRemoved(const FAssetData& AssetData);
+
+	// Called when an asset is renamed or moved.
+	void HandleOnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+
+	// Called when the Asset Registry finishes the initial scan.
+	void HandleOnFilesLoaded();
+
+	// Called when a package is saved, updates the values of its assets without waiting for the Asset Registry.
+	void HandleOnPackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext ObjectSaveContext);
+
+	// Adds the values of an asset that is not in the index. If bKeepSorted is false, the caller must sort the entries.
+	// The write lock must be held.
+	void AddAssetLocked(const FSoftObjectPath& AssetPath, TConstArrayView<FPickableDateTimeAssetTags::FValue> Values, bool bKeepSorted);
+
+	// Removes the values of an asset. The write lock must be held.
+	void RemoveAssetLocked(int32 AssetIndex);
+
+	// Returns the index of the tag, or INDEX_NONE if it is not in the index. The read lock must be held.
+	int32 FindTagIndexLocked(FName TagName) const;
+
+private:
+	// All values sorted by ticks.
+	TArray<FEntry> Entries;
+
+	// The paths of the assets. Elements of removed assets are empty and reused.
+	TArray<FSoftObjectPath> AssetPaths;
+	TMap<FSoftObjectPath, int32> AssetIndices;
+	TArray<int32> FreeAssetIndices;
+
+	// The distinct ticks of the values of each asset in ascending order, to find its entries without scanning all of them.
+	TArray<TArray<int64>> AssetTicks;
+
+	// The names of the tags referenced by the entries.
+	TArray<FName> TagNames;
+	TMap<FName, int32> TagIndices;
+
+	// Guards all of the above.
+	mutable FRWLock Lock;
+
+	// Handles of the bound events.
+	FDelegateHandle OnAssetAddedHandle;
+	FDelegateHandle OnAssetUpdatedHandle;
+	FDelegateHandle OnAssetRemovedHandle;
+	FDelegateHandle OnAssetRenamedHandle;
+	FDelegateHandle OnFilesLoadedHandle;
+	FDelegateHandle OnPackageSavedHandle;
+};
+#endif
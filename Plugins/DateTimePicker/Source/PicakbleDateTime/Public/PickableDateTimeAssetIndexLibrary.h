@@ -0,0 +1,27 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "PickableDateTime.h"
+#include "PickableDateTimeAssetIndexLibrary.generated.h"
+
+/**
+ * Functions to search assets by the values of their FPickableDateTime properties, e.g. from Editor Utility Widgets.
+ * Assets are found through their Asset Registry tags and are not loaded.
+ * The functions are only available in the editor.
+ */
+UCLASS()
+class PICKABLEDATETIME_API UPickableDateTimeAssetIndexLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+#if WITH_EDITOR
+	// Finds the assets that have a value in [From, To].
+	// PropertyPath limits the search to a property, e.g. "Schedule.Start". If empty, all properties are searched.
+	UFUNCTION(BlueprintCallable, Category = "Pickable Date Time|Asset Index")
+	static TArray<FSoftObjectPath> FindAssetsInDateRange(const FPickableDateTime& From, const FPickableDateTime& To, const FString& PropertyPath);
+#endif
+};
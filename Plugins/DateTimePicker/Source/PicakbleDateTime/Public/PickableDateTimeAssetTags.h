@@ -0,0 +1,58 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+
+struct FAssetData;
+
+/**
+ * Exports the FPickableDateTime properties of assets as Asset Registry tags, so that assets can be
+ * searched by date without loading them.
+ * Every FPickableDateTime in an asset (or in the class defaults of a Blueprint), including those in nested structs
+ * and containers, is exported under a tag named "PickableDateTime.<PropertyPath>", e.g. "PickableDateTime.Schedule.Start".
+ * The value is formatted as "yyyy.mm.dd-hh.mm.ss.mmm", which sorts in chronological order as text, and
+ * properties with several values (arrays, sets and maps) join them with commas.
+ */
+struct PICKABLEDATETIME_API FPickableDateTimeAssetTags
+{
+public:
+	// The prefix of the names of the tags.
+	static const TCHAR* TagPrefix;
+
+	// A value found in an object, with the name of the tag it is exported under.
+	struct FValue
+	{
+		FName TagName;
+		FDateTime DateTime;
+	};
+
+public:
+	// Registers the exporter so that the tags are added to all assets. Does nothing outside the editor.
+	static void Register();
+	static void Unregister();
+
+	// Appends the tags of all FPickableDateTime properties of the object.
+	// Can be called from GetAssetRegistryTags of classes that are saved when the exporter is not registered.
+	static void GetAssetRegistryTags(const UObject* Object, TArray<UObject::FAssetRegistryTag>& OutTags);
+
+	// Collects all FPickableDateTime values of the object, grouped by tag in the order of the properties.
+	static void CollectValues(const UObject* Object, TArray<FValue>& OutValues);
+
+	// Appends the values in the tags of the asset that have the tag prefix.
+	// Returns the number of values found.
+	static int32 GetValuesFromAssetData(const FAssetData& AssetData, TArray<FValue>& OutValues);
+
+	// Returns whether the tag was exported by this class.
+	static bool IsTagName(FName TagName);
+
+	// Returns the name of the tag for the property path.
+	static FName MakeTagName(FStringView PropertyPath);
+
+	// Formats the values as a tag value.
+	static FString MakeTagValue(TConstArrayView<FDateTime> DateTimes);
+
+	// Appends the values in the tag value. Returns the number of values found.
+	static int32 ParseTagValue(const TCHAR* TagValue, TArray<FDateTime>& OutDateTimes);
+};
@@ -0,0 +1,248 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Calendar calculations on the proleptic Gregorian calendar used by FDateTime.
+ * All functions are pure and have no shared state, so they can be called from any thread,
+ * including ParallelFor and UE Tasks.
+ * The functions that take a day number work on the number of days since January 1, 0001 (the day of FDateTime ticks 0)
+ * and are constexpr. The functions that take FDateTime are thin wrappers around them.
+ */
+namespace PickableDateTimeCalendar
+{
+	// The day number of January 1, 1970.
+	static constexpr int64 UnixEpochDayNumber = 719162;
+
+	// Returns whether the year is a leap year.
+	constexpr bool IsLeapYear(int32 Year)
+	{
+		return ((Year % 4 == 0) && (Year % 100 != 0)) || (Year % 400 == 0);
+	}
+
+	// Returns the number of days in the month.
+	constexpr int32 DaysInMonth(int32 Year, int32 Month)
+	{
+		constexpr int32 DaysPerMonth[12] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+		return (Month == 2 && IsLeapYear(Year)) ? 29 : DaysPerMonth[Month - 1];
+	}
+
+	// Returns the day clamped to the number of days in the month.
+	constexpr int32 GetNormalizedDay(int32 Year, int32 Month, int32 Day)
+	{
+		const int32 NumDays = DaysInMonth(Year, Month);
+		return (Day > NumDays) ? NumDays : Day;
+	}
+
+	// Converts a date to the day number.
+	constexpr int64 DaysFromCivil(int32 Year, int32 Month, int32 Day)
+	{
+		// Count from March 1 so that the leap day is at the end of the year.
+		const int64 ShiftedYear = static_cast<int64>(Year) - ((Month <= 2) ? 1 : 0);
+		const int64 Era = ((ShiftedYear >= 0) ? ShiftedYear : (ShiftedYear - 399)) / 400;
+		const int64 YearOfEra = ShiftedYear - (Era * 400);
+		const int64 DayOfYear = ((153 * (Month + ((Month > 2) ? -3 : 9))) + 2) / 5 + Day - 1;
+		const int64 DayOfEra = (YearOfEra * 365) + (YearOfEra / 4) - (YearOfEra / 100) + DayOfYear;
+		return (Era * 146097) + DayOfEra - 719468 + UnixEpochDayNumber;
+	}
+
+	// Converts the day number to a date.
+	constexpr void CivilFromDays(int64 DayNumber, int32& OutYear, int32& OutMonth, int32& OutDay)
+	{
+		const int64 ShiftedDays = DayNumber - UnixEpochDayNumber + 719468;
+		const int64 Era = ((ShiftedDays >= 0) ? ShiftedDays : (ShiftedDays - 146096)) / 146097;
+		const int64 DayOfEra = ShiftedDays - (Era * 146097);
+		const int64 YearOfEra = (DayOfEra - (DayOfEra / 1460) + (DayOfEra / 36524) - (DayOfEra / 146096)) / 365;
+		const int64 DayOfYear = DayOfEra - ((365 * YearOfEra) + (YearOfEra / 4) - (YearOfEra / 100));
+		const int64 ShiftedMonth = ((5 * DayOfYear) + 2) / 153;
+
+		OutDay = static_cast<int32>(DayOfYear - (((153 * ShiftedMonth) + 2) / 5) + 1);
+		OutMonth = static_cast<int32>((ShiftedMonth < 10) ? (ShiftedMonth + 3) : (ShiftedMonth - 9));
+		OutYear = static_cast<int32>(YearOfEra + (Era * 400) + ((OutMonth <= 2) ? 1 : 0));
+	}
+
+	// Returns the index of EDayOfWeek (Monday is 0) of the day number.
+	constexpr int32 GetDayOfWeekIndex(int64 DayNumber)
+	{
+		// January 1, 0001 was a Monday.
+		return static_cast<int32>(((DayNumber % 7) + 7) % 7);
+	}
+
+	// Returns whether the day is a weekday (Monday to Friday).
+	constexpr bool IsBusinessDay(int64 DayNumber)
+	{
+		return (GetDayOfWeekIndex(DayNumber) < 5);
+	}
+
+	// Returns the day number after adding months, clamping the day to the length of the resulting month.
+	constexpr int64 AddMonths(int64 DayNumber, int32 NumMonths)
+	{
+		int32 Year = 0, Month = 0, Day = 0;
+		CivilFromDays(DayNumber, Year, Month, Day);
+
+		const int64 TotalMonths = (static_cast<int64>(Year) * 12) + (Month - 1) + NumMonths;
+		const int64 NewYear = ((TotalMonths >= 0) ? TotalMonths : (TotalMonths - 11)) / 12;
+		const int32 NewMonth = static_cast<int32>(TotalMonths - (NewYear * 12)) + 1;
+		return DaysFromCivil(static_cast<int32>(NewYear), NewMonth, GetNormalizedDay(static_cast<int32>(NewYear), NewMonth, Day));
+	}
+
+	// Returns the day number of the first day of the week containing the day.
+	constexpr int64 StartOfWeek(int64 DayNumber, int32 FirstDayOfWeekIndex = 0)
+	{
+		return DayNumber - ((GetDayOfWeekIndex(DayNumber) - FirstDayOfWeekIndex + 7) % 7);
+	}
+
+	// Returns the day number of the first day of the month containing the day.
+	constexpr int64 StartOfMonth(int64 DayNumber)
+	{
+		int32 Year = 0, Month = 0, Day = 0;
+		CivilFromDays(DayNumber, Year, Month, Day);
+		return DayNumber - (Day - 1);
+	}
+
+	// Returns the day number of the first day of the quarter containing the day.
+	constexpr int64 StartOfQuarter(int64 DayNumber)
+	{
+		int32 Year = 0, Month = 0, Day = 0;
+		CivilFromDays(DayNumber, Year, Month, Day);
+		return DaysFromCivil(Year, (((Month - 1) / 3) * 3) + 1, 1);
+	}
+
+	// Returns the day number of the first day of the year containing the day.
+	constexpr int64 StartOfYear(int64 DayNumber)
+	{
+		int32 Year = 0, Month = 0, Day = 0;
+		CivilFromDays(DayNumber, Year, Month, Day);
+		return DaysFromCivil(Year, 1, 1);
+	}
+
+	// Returns the day number of the first cell of a 6-week month calendar whose rows start on the day of the week.
+	constexpr int64 GetFirstDayOfMonthGrid(int64 DayNumber, int32 FirstDayOfWeekIndex = 0)
+	{
+		return StartOfWeek(StartOfMonth(DayNumber), FirstDayOfWeekIndex);
+	}
+
+	// Returns the ISO-8601 week number (1 to 53) and the year the week belongs to.
+	constexpr int32 GetIsoWeek(int64 DayNumber, int32& OutWeekYear)
+	{
+		// The ISO week belongs to the year that contains its Thursday.
+		const int64 Thursday = DayNumber - GetDayOfWeekIndex(DayNumber) + 3;
+
+		int32 Year = 0, Month = 0, Day = 0;
+		CivilFromDays(Thursday, Year, Month, Day);
+
+		OutWeekYear = Year;
+		return static_cast<int32>((Thursday - DaysFromCivil(Year, 1, 1)) / 7) + 1;
+	}
+
+	// Returns the day number after stepping the number of business days, skipping Saturdays and Sundays.
+	// Stepping from a weekend counts from the adjacent business day, e.g. one business day after Saturday is Monday.
+	constexpr int64 AddBusinessDays(int64 DayNumber, int32 NumBusinessDays)
+	{
+		if (NumBusinessDays == 0)
+		{
+			return DayNumber;
+		}
+
+		const int32 DayOfWeekIndex = GetDayOfWeekIndex(DayNumber);
+		if (NumBusinessDays > 0)
+		{
+			// Count from the previous Friday when starting on a weekend.
+			const int64 Start = DayNumber - ((DayOfWeekIndex >= 5) ? (DayOfWeekIndex - 4) : 0);
+			const int32 StartIndex = (DayOfWeekIndex >= 5) ? 4 : DayOfWeekIndex;
+			const int64 NumWeeks = NumBusinessDays / 5;
+			const int32 Remainder = NumBusinessDays % 5;
+			return Start + (NumWeeks * 7) + Remainder + ((StartIndex + Remainder >= 5) ? 2 : 0);
+		}
+
+		// Count from the next Monday when starting on a weekend.
+		const int64 Start = DayNumber + ((DayOfWeekIndex >= 5) ? (7 - DayOfWeekIndex) : 0);
+		const int32 StartIndex = (DayOfWeekIndex >= 5) ? 0 : DayOfWeekIndex;
+		const int64 NumWeeks = -static_cast<int64>(NumBusinessDays) / 5;
+		const int32 Remainder = static_cast<int32>(-static_cast<int64>(NumBusinessDays) % 5);
+		return Start - (NumWeeks * 7) - Remainder - ((StartIndex - Remainder < 0) ? 2 : 0);
+	}
+
+	static_assert(DaysFromCivil(1, 1, 1) == 0, "Day number 0 must be January 1, 0001.");
+	static_assert(DaysFromCivil(1970, 1, 1) == UnixEpochDayNumber, "The Unix epoch must match.");
+	static_assert(GetDayOfWeekIndex(DaysFromCivil(2024, 1, 1)) == 0, "January 1, 2024 is a Monday.");
+	static_assert(AddMonths(DaysFromCivil(2024, 1, 31), 1) == DaysFromCivil(2024, 2, 29), "The day must be clamped to the month.");
+	static_assert(AddBusinessDays(DaysFromCivil(2024, 1, 5), 1) == DaysFromCivil(2024, 1, 8), "Friday + 1 business day is Monday.");
+
+	// Wrappers for FDateTime.
+
+	// Returns the day number of the date and time.
+	FORCEINLINE int64 ToDayNumber(const FDateTime& DateTime)
+	{
+		return DateTime.GetTicks() / ETimespan::TicksPerDay;
+	}
+
+	// Returns the date and time of the day number and the ticks of the time of day.
+	FORCEINLINE FDateTime FromDayNumber(int64 DayNumber, int64 TimeOfDayTicks = 0)
+	{
+		return FDateTime((DayNumber * ETimespan::TicksPerDay) + TimeOfDayTicks);
+	}
+
+	// Returns the ticks of the time of day.
+	FORCEINLINE int64 GetTimeOfDayTicks(const FDateTime& DateTime)
+	{
+		return DateTime.GetTicks() % ETimespan::TicksPerDay;
+	}
+
+	// Adds months, clamping the day to the length of the resulting month and keeping the time of day.
+	FORCEINLINE FDateTime AddMonths(const FDateTime& DateTime, int32 NumMonths)
+	{
+		return FromDayNumber(AddMonths(ToDayNumber(DateTime), NumMonths), GetTimeOfDayTicks(DateTime));
+	}
+
+	// Steps the number of business days, keeping the time of day.
+	FORCEINLINE FDateTime AddBusinessDays(const FDateTime& DateTime, int32 NumBusinessDays)
+	{
+		return FromDayNumber(AddBusinessDays(ToDayNumber(DateTime), NumBusinessDays), GetTimeOfDayTicks(DateTime));
+	}
+
+	// Returns midnight of the first day of the week.
+	FORCEINLINE FDateTime StartOfWeek(const FDateTime& DateTime, EDayOfWeek FirstDayOfWeek = EDayOfWeek::Monday)
+	{
+		return FromDayNumber(StartOfWeek(ToDayNumber(DateTime), static_cast<int32>(FirstDayOfWeek)));
+	}
+
+	// Returns midnight of the first day of the month.
+	FORCEINLINE FDateTime StartOfMonth(const FDateTime& DateTime)
+	{
+		return FromDayNumber(StartOfMonth(ToDayNumber(DateTime)));
+	}
+
+	// Returns midnight of the first day of the quarter.
+	FORCEINLINE FDateTime StartOfQuarter(const FDateTime& DateTime)
+	{
+		return FromDayNumber(StartOfQuarter(ToDayNumber(DateTime)));
+	}
+
+	// Returns midnight of the first day of the year.
+	FORCEINLINE FDateTime StartOfYear(const FDateTime& DateTime)
+	{
+		return FromDayNumber(StartOfYear(ToDayNumber(DateTime)));
+	}
+
+	// Returns midnight of the first cell of a 6-week month calendar.
+	FORCEINLINE FDateTime GetFirstDateOfMonthGrid(const FDateTime& DateTime, EDayOfWeek FirstDayOfWeek = EDayOfWeek::Monday)
+	{
+		return FromDayNumber(GetFirstDayOfMonthGrid(ToDayNumber(DateTime), static_cast<int32>(FirstDayOfWeek)));
+	}
+
+	// Returns the ISO-8601 week number (1 to 53).
+	FORCEINLINE int32 GetIsoWeekNumber(const FDateTime& DateTime)
+	{
+		int32 WeekYear = 0;
+		return GetIsoWeek(ToDayNumber(DateTime), WeekYear);
+	}
+
+	// Returns whether the date is a weekday (Monday to Friday).
+	FORCEINLINE bool IsBusinessDay(const FDateTime& DateTime)
+	{
+		return IsBusinessDay(ToDayNumber(DateTime));
+	}
+}
@@ -0,0 +1,60 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Culture dependent data needed to display a calendar, such as the first day of the week and localized names.
+ * It is resolved once per culture change and shared by all users, so displaying a calendar
+ * does not need any locale lookups or string formatting.
+ */
+struct PICKABLEDATETIME_API FPickableDateTimeCalendarDescriptor
+{
+public:
+	// The largest number that has a cached text.
+	static constexpr int32 MaxCachedNumber = 99;
+
+	// The name of the culture this descriptor was resolved for.
+	FString CultureName;
+
+	// The culture this descriptor was resolved for, used to format the numbers that are not cached.
+	FCulturePtr Culture;
+
+	// The day of the week that the calendar starts on in this culture.
+	EDayOfWeek FirstDayOfWeek = EDayOfWeek::Monday;
+
+	// Abbreviated names of the days of the week, indexed by EDayOfWeek.
+	FText ShortDayNames[7];
+
+	// Names of the months, indexed by month - 1.
+	FText MonthNames[12];
+
+	// Header text of the week number column.
+	FText WeekNumberHeader;
+
+	// Localized texts of the numbers from 0 to MaxCachedNumber, used for days, months, weeks and times.
+	FText NumberTexts[MaxCachedNumber + 1];
+
+public:
+	// Returns the descriptor of the current culture. Must be called from the game thread.
+	static TSharedRef<const FPickableDateTimeCalendarDescriptor> Get();
+
+	// Discards the cached descriptor so that it is resolved again on next use.
+	static void Invalidate();
+
+	// Creates a descriptor for the culture.
+	static TSharedRef<FPickableDateTimeCalendarDescriptor> Create(const FCultureRef& Culture);
+
+	// Returns the day of the week of the column in a calendar starting on FirstDayOfWeek.
+	static EDayOfWeek GetDayOfWeekOfColumn(EDayOfWeek InFirstDayOfWeek, int32 Column);
+
+	// Returns the column of the day of the week in a calendar starting on FirstDayOfWeek.
+	static int32 GetColumnOfDayOfWeek(EDayOfWeek InFirstDayOfWeek, EDayOfWeek DayOfWeek);
+
+	// Returns the ISO-8601 week number (1 to 53) of the date.
+	static int32 GetIsoWeekNumber(const FDateTime& DateTime);
+
+	// Returns the text of the number, using the cached text if possible.
+	FText GetNumberText(int32 Number) const;
+};
@@ -0,0 +1,97 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PickableDateTime.h"
+
+class FProperty;
+
+/**
+ * Metadata specifiers that can be added to FPickableDateTime properties to constrain the selectable dates.
+ * e.g. UPROPERTY(EditAnywhere, meta = (MinDate = "2024-01-01", MaxDate = "2024-12-31", DisallowWeekends))
+ */
+namespace PickableDateTimeMetaData
+{
+	// The earliest date that can be selected (inclusive).
+	static const FName MinDate = TEXT("MinDate");
+
+	// The latest date that can be selected (inclusive).
+	static const FName MaxDate = TEXT("MaxDate");
+
+	// Prevents Saturdays and Sundays from being selected.
+	static const FName DisallowWeekends = TEXT("DisallowWeekends");
+
+	// Writes the value to the property while navigating the date time picker, before OK is pressed.
+	static const FName LivePreview = TEXT("LivePreview");
+
+	// The maximum number of live preview writes per second. The default is 10.
+	static const FName LivePreviewRate = TEXT("LivePreviewRate");
+
+	// The day of the week that the date time picker starts on, such as "Sunday". The default depends on the culture.
+	static const FName FirstDayOfWeek = TEXT("FirstDayOfWeek");
+
+	// Shows the ISO week numbers in the date time picker.
+	static const FName ShowWeekNumbers = TEXT("ShowWeekNumbers");
+}
+
+/**
+ * A set of constraints on the dates that can be set to FPickableDateTime.
+ * Parse once from the property metadata and reuse it for every evaluation.
+ */
+struct PICKABLEDATETIME_API FPickableDateTimeConstraints
+{
+public:
+	// The number of cells in the day mode calendar grid (7 days * 6 weeks).
+	static constexpr int32 NumDayGridCells = 42;
+
+	// The earliest date that can be selected.
+	TOptional<FDateTime> MinDate;
+
+	// The latest date that can be selected. Any time on this day is allowed.
+	TOptional<FDateTime> MaxDate;
+
+	// Whether Saturdays and Sundays can't be selected.
+	bool bDisallowWeekends = false;
+
+public:
+	// Creates constraints from the string values written in the metadata.
+	static FPickableDateTimeConstraints FromMetaData(const FString& MinDateString, const FString& MaxDateString, bool bInDisallowWeekends);
+
+#if WITH_EDITOR
+	// Creates constraints from the metadata of the property.
+	static FPickableDateTimeConstraints FromProperty(const FProperty* Property);
+#endif
+
+	// Returns whether there are any constraints.
+	bool IsConstrained() const;
+
+	// Returns whether the date and time satisfies all the constraints.
+	bool IsAllowed(const FDateTime& DateTime) const;
+
+	/**
+	 * Moves the date to the closest day that satisfies the constraints, keeping the time of day.
+	 * Returns false if no day in [MinDate, MaxDate] is allowed, e.g. a range of only a weekend with DisallowWeekends.
+	 * OutDateTime is then only moved into [MinDate, MaxDate] and does not satisfy the constraints.
+	 */
+	bool TryClamp(const FDateTime& DateTime, FDateTime& OutDateTime) const;
+
+	// Returns the closest date and time that satisfies the constraints, or the result of TryClamp if none does.
+	FDateTime Clamp(const FDateTime& DateTime) const;
+
+	/**
+	 * Calculates which cells in the day mode calendar grid are disabled by the constraints.
+	 * Bit N corresponds to the date FirstGridDate + N days, and only the lower 42 bits are used.
+	 */
+	uint64 GetDisabledDayMask(const FDateTime& FirstGridDate) const;
+
+	/**
+	 * Checks all the values and collects the indices of those that do not satisfy the constraints.
+	 * Returns true if all values are valid.
+	 */
+	bool Validate(TConstArrayView<FPickableDateTime> Values, TArray<int32>& OutInvalidIndices) const;
+	bool Validate(TConstArrayView<FDateTime> Values, TArray<int32>& OutInvalidIndices) const;
+
+	// Returns a mask with the bits in the range [FirstIndex, LastIndex] of the day mode calendar grid set.
+	static uint64 MakeDayGridRangeMask(int64 FirstIndex, int64 LastIndex);
+};
@@ -0,0 +1,248 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PickableDateTime.h"
+
+/**
+ * An open addressing hash map that uses the ticks of a date and time as the key.
+ * Keys and values are stored in flat arrays and collisions are resolved by linear probing,
+ * so it uses less memory and is faster than TMap<FPickableDateTime, ValueType> for large numbers of entries.
+ * ValueType must be default constructible. The ticks MIN_int64 can't be used as a key.
+ */
+template<typename ValueType>
+class TPickableDateTimeFlatMap
+{
+public:
+	// Constructor.
+	TPickableDateTimeFlatMap() = default;
+	explicit TPickableDateTimeFlatMap(int32 ExpectedNumElements)
+	{
+		Reserve(ExpectedNumElements);
+	}
+
+	// Returns the number of elements.
+	int32 Num() const
+	{
+		return NumElements;
+	}
+
+	// Returns whether there are no elements.
+	bool IsEmpty() const
+	{
+		return (NumElements == 0);
+	}
+
+	// Allocates enough slots to store the specified number of elements without rehashing.
+	void Reserve(int32 ExpectedNumElements)
+	{
+		const int32 RequiredSlots = GetRequiredNumSlots(ExpectedNumElements);
+		if (RequiredSlots > Keys.Num())
+		{
+			Rehash(RequiredSlots);
+		}
+	}
+
+	// Removes all elements and frees the memory.
+	void Empty()
+	{
+		Keys.Empty();
+		Values.Empty();
+		NumElements = 0;
+	}
+
+	// Sets the value for the key, overwriting the existing value.
+	ValueType& Add(const FDateTime& Key, const ValueType& Value)
+	{
+		ValueType& Slot = FindOrAdd(Key);
+		Slot = Value;
+		return Slot;
+	}
+
+	ValueType& Add(const FDateTime& Key, ValueType&& Value)
+	{
+		ValueType& Slot = FindOrAdd(Key);
+		Slot = MoveTemp(Value);
+		return Slot;
+	}
+
+	// Returns the value for the key, adding a default value if the key does not exist.
+	ValueType& FindOrAdd(const FDateTime& Key)
+	{
+		const int64 Ticks = Key.GetTicks();
+		check(Ticks != EmptyKey);
+
+		if (GetRequiredNumSlots(NumElements + 1) > Keys.Num())
+		{
+			Rehash(GetRequiredNumSlots(NumElements + 1));
+		}
+
+		const uint32 Mask = static_cast<uint32>(Keys.Num() - 1);
+		for (uint32 SlotIndex = PickableDateTimeHash::MixTicks(Ticks) & Mask; ; SlotIndex = (SlotIndex + 1) & Mask)
+		{
+			if (Keys[SlotIndex] == Ticks)
+			{
+				return Values[SlotIndex];
+			}
+			if (Keys[SlotIndex] == EmptyKey)
+			{
+				Keys[SlotIndex] = Ticks;
+				NumElements++;
+				return Values[SlotIndex];
+			}
+		}
+	}
+
+	// Returns a pointer to the value for the key, or nullptr if the key does not exist.
+	ValueType* Find(const FDateTime& Key)
+	{
+		const int32 SlotIndex = FindSlot(Key.GetTicks());
+		return (SlotIndex != INDEX_NONE) ? &Values[SlotIndex] : nullptr;
+	}
+
+	const ValueType* Find(const FDateTime& Key) const
+	{
+		const int32 SlotIndex = FindSlot(Key.GetTicks());
+		return (SlotIndex != INDEX_NONE) ? &Values[SlotIndex] : nullptr;
+	}
+
+	// Returns whether the key exists.
+	bool Contains(const FDateTime& Key) const
+	{
+		return (FindSlot(Key.GetTicks()) != INDEX_NONE);
+	}
+
+	// Removes the key and returns whether it existed.
+	bool Remove(const FDateTime& Key)
+	{
+		int32 SlotIndex = FindSlot(Key.GetTicks());
+		if (SlotIndex == INDEX_NONE)
+		{
+			return false;
+		}
+
+		// Shift the following elements back instead of leaving a tombstone so that lookups stay short.
+		const uint32 Mask = static_cast<uint32>(Keys.Num() - 1);
+		uint32 EmptyIndex = static_cast<uint32>(SlotIndex);
+		for (uint32 NextIndex = (EmptyIndex + 1) & Mask; Keys[NextIndex] != EmptyKey; NextIndex = (NextIndex + 1) & Mask)
+		{
+			// Elements whose home slot is cyclically in (EmptyIndex, NextIndex] must stay where they are.
+			const uint32 HomeIndex = PickableDateTimeHash::MixTicks(Keys[NextIndex]) & Mask;
+			const bool bStays = (EmptyIndex <= NextIndex)
+				? (EmptyIndex < HomeIndex && HomeIndex <= NextIndex)
+				: (EmptyIndex < HomeIndex || HomeIndex <= NextIndex);
+			if (!bStays)
+			{
+				Keys[EmptyIndex] = Keys[NextIndex];
+				Values[EmptyIndex] = MoveTemp(Values[NextIndex]);
+				EmptyIndex = NextIndex;
+			}
+		}
+
+		Keys[EmptyIndex] = EmptyKey;
+		Values[EmptyIndex] = ValueType();
+		NumElements--;
+		return true;
+	}
+
+	// Calls the function for each element in no particular order.
+	template<typename FunctionType>
+	void ForEach(FunctionType&& Function) const
+	{
+		for (int32 SlotIndex = 0; SlotIndex < Keys.Num(); SlotIndex++)
+		{
+			if (Keys[SlotIndex] != EmptyKey)
+			{
+				Function(FDateTime(Keys[SlotIndex]), Values[SlotIndex]);
+			}
+		}
+	}
+
+	// Returns the number of bytes allocated by this container.
+	SIZE_T GetAllocatedSize() const
+	{
+		return Keys.GetAllocatedSize() + Values.GetAllocatedSize();
+	}
+
+private:
+	// Returns the number of slots that keeps the load factor at or below 3/4.
+	static int32 GetRequiredNumSlots(int32 NumRequiredElements)
+	{
+		if (NumRequiredElements <= 0)
+		{
+			return 0;
+		}
+
+		const int64 MinSlots = FMath::Max<int64>((static_cast<int64>(NumRequiredElements) * 4 + 2) / 3, MinNumSlots);
+		return static_cast<int32>(FMath::RoundUpToPowerOfTwo64(static_cast<uint64>(MinSlots)));
+	}
+
+	// Returns the slot index of the key, or INDEX_NONE if the key does not exist.
+	int32 FindSlot(int64 Ticks) const
+	{
+		if (NumElements == 0 || Ticks == EmptyKey)
+		{
+			return INDEX_NONE;
+		}
+
+		const uint32 Mask = static_cast<uint32>(Keys.Num() - 1);
+		for (uint32 SlotIndex = PickableDateTimeHash::MixTicks(Ticks) & Mask; ; SlotIndex = (SlotIndex + 1) & Mask)
+		{
+			if (Keys[SlotIndex] == Ticks)
+			{
+				return static_cast<int32>(SlotIndex);
+			}
+			if (Keys[SlotIndex] == EmptyKey)
+			{
+				return INDEX_NONE;
+			}
+		}
+	}
+
+	// Reallocates the slots and reinserts all elements.
+	void Rehash(int32 NewNumSlots)
+	{
+		check(FMath::IsPowerOfTwo(NewNumSlots));
+
+		TArray<int64> OldKeys = MoveTemp(Keys);
+		TArray<ValueType> OldValues = MoveTemp(Values);
+
+		Keys.Init(EmptyKey, NewNumSlots);
+		Values.SetNum(NewNumSlots);
+
+		const uint32 Mask = static_cast<uint32>(NewNumSlots - 1);
+		for (int32 OldIndex = 0; OldIndex < OldKeys.Num(); OldIndex++)
+		{
+			if (OldKeys[OldIndex] == EmptyKey)
+			{
+				continue;
+			}
+
+			uint32 SlotIndex = PickableDateTimeHash::MixTicks(OldKeys[OldIndex]) & Mask;
+			while (Keys[SlotIndex] != EmptyKey)
+			{
+				SlotIndex = (SlotIndex + 1) & Mask;
+			}
+
+			Keys[SlotIndex] = OldKeys[OldIndex];
+			Values[SlotIndex] = MoveTemp(OldValues[OldIndex]);
+		}
+	}
+
+private:
+	// The key that represents an empty slot.
+	static constexpr int64 EmptyKey = MIN_int64;
+
+	// The smallest number of slots to allocate.
+	static constexpr int64 MinNumSlots = 16;
+
+	// The ticks of each slot. Empty slots are EmptyKey.
+	TArray<int64> Keys;
+
+	// The value of each slot.
+	TArray<ValueType> Values;
+
+	// The number of elements stored.
+	int32 NumElements = 0;
+};
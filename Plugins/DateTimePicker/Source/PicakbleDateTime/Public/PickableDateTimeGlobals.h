@@ -0,0 +1,10 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Categories used for log output with this module.
+ */
+PICKABLEDATETIME_API DECLARE_LOG_CATEGORY_EXTERN(LogPickableDateTime, Log, All);
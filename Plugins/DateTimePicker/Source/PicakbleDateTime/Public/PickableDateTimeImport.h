@@ -0,0 +1,57 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PickableDateTime.h"
+
+/**
+ * Information about a value that could not be imported.
+ */
+struct PICKABLEDATETIME_API FPickableDateTimeImportError
+{
+public:
+	// Index of the row that failed to import.
+	int32 RowIndex = INDEX_NONE;
+
+	// The text that could not be parsed.
+	FString Text;
+};
+
+/**
+ * Fast import path for FPickableDateTime used by text import, such as DataTable CSV and JSON.
+ * The following formats are accepted:
+ *   - ISO-8601                   e.g. 2024-01-31T12:00:00Z
+ *   - FDateTime::ToString format e.g. 2024.01.31-12.00.00 or 2024.01.31-12.00.00.123
+ *   - Unix epoch seconds         e.g. 1706702400
+ *   - Unix epoch milliseconds    e.g. 1706702400000
+ *   - FDateTime ticks            e.g. 638422992000000000
+ * Integers are classified by their number of digits: 17 or more are ticks, 12 or more are milliseconds
+ * and 9 to 11 are seconds. Shorter integers such as 2024 are rejected rather than read as seconds.
+ */
+struct PICKABLEDATETIME_API FPickableDateTimeImport
+{
+public:
+	// The longest text that can be parsed as a date and time.
+	static constexpr int32 MaxTextLength = 63;
+
+	// Formats the date and time as its ticks padded to 19 digits, so that ParseText reads back every tick unlike ISO-8601 which keeps only milliseconds.
+	static FString MakeText(const FDateTime& DateTime);
+
+	// Parses a null-terminated text. Leading and trailing whitespace and quotes are ignored.
+	static bool ParseText(const TCHAR* Text, FDateTime& OutDateTime);
+
+	/**
+	 * Reads one date and time token from the beginning of the buffer and advances the buffer past it.
+	 * The token ends at a comma, a closing parenthesis or whitespace, so it can be used inside struct text.
+	 * The buffer is not advanced on failure.
+	 */
+	static bool ParseToken(const TCHAR*& Buffer, FDateTime& OutDateTime);
+
+	/**
+	 * Parses all texts in parallel.
+	 * OutValues has the same number of elements as Texts, and the rows that fail are set to FDateTime::MinValue().
+	 * Returns true if all rows were parsed successfully.
+	 */
+	static bool ParseBatch(TConstArrayView<FString> Texts, TArray<FPickableDateTime>& OutValues, TArray<FPickableDateTimeImportError>& OutErrors);
+};
@@ -0,0 +1,59 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PickableDateTime.h"
+
+/**
+ * A map key that buckets date and times at the specified resolution.
+ * All date and times within the same bucket are treated as the same key.
+ * e.g. TMap<FPickableDateTimePerSecond, int32> counts events per second.
+ */
+template<int64 ResolutionTicks>
+struct TQuantizedPickableDateTime
+{
+	static_assert(ResolutionTicks > 0, "The resolution must be at least one tick.");
+
+public:
+	// Index of the bucket, which is the ticks divided by the resolution.
+	int64 Bucket = 0;
+
+public:
+	// Constructor.
+	TQuantizedPickableDateTime() = default;
+	explicit TQuantizedPickableDateTime(const FDateTime& DateTime) : Bucket(DateTime.GetTicks() / ResolutionTicks) {}
+	explicit TQuantizedPickableDateTime(const FPickableDateTime& PickableDateTime) : TQuantizedPickableDateTime(PickableDateTime.DateTime) {}
+
+	// Returns the earliest date and time in the bucket.
+	FDateTime GetBucketStart() const
+	{
+		return FDateTime(Bucket * ResolutionTicks);
+	}
+
+	bool operator==(const TQuantizedPickableDateTime& Other) const
+	{
+		return (Bucket == Other.Bucket);
+	}
+
+	bool operator!=(const TQuantizedPickableDateTime& Other) const
+	{
+		return (Bucket != Other.Bucket);
+	}
+
+	bool operator<(const TQuantizedPickableDateTime& Other) const
+	{
+		return (Bucket < Other.Bucket);
+	}
+
+	// Define a GetTypeHash function so that it can be used as a map key.
+	friend FORCEINLINE uint32 GetTypeHash(const TQuantizedPickableDateTime& Key)
+	{
+		return PickableDateTimeHash::MixTicks(Key.Bucket);
+	}
+};
+
+using FPickableDateTimePerSecond = TQuantizedPickableDateTime<ETimespan::TicksPerSecond>;
+using FPickableDateTimePerMinute = TQuantizedPickableDateTime<ETimespan::TicksPerMinute>;
+using FPickableDateTimePerHour = TQuantizedPickableDateTime<ETimespan::TicksPerHour>;
+using FPickableDateTimePerDay = TQuantizedPickableDateTime<ETimespan::TicksPerDay>;
@@ -0,0 +1,76 @@
+// Copyright 2021 Naotsun. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * A precompiled quick entry expression for date and times, such as "+3d", "next fri" or "eom".
+ * Parse the text once and evaluate it against any reference date and time without allocating.
+ *
+ * An expression is a sequence of whitespace separated terms that are applied from left to right:
+ *   - Offsets:   +3d, -2w, +1m, +1y, +4h, 3 days (units: d/day, w/wk/week, m/mo/month, y/yr/year, h/hr/hour)
+ *   - Anchors:   now, today, tomorrow, yesterday
+ *   - Weekdays:  mon..sun (on or after), next fri (strictly after), last fri (strictly before)
+ *   - Boundaries: sow/eow (week), som/eom (month), soy/eoy (year)
+ *   - Absolute:  2025, 2025-06, 2025-06-15 and any ISO-8601 date and time
+ * Unless the expression specifies a time, the time of day of the reference is kept.
+ * e.g. "eom -1w" is one week before the last day of the month of the reference.
+ */
+struct PICKABLEDATETIME_API FPickableDateTimeQuickEntry
+{
+public:
+	// The kinds of operations that a term compiles to.
+	enum class EOperation : uint8
+	{
+		SetNow,
+		SetToday,
+		SetDate,
+		SetDateTime,
+		AddTicks,
+		AddDays,
+		AddMonths,
+		NextWeekday,
+		OnOrAfterWeekday,
+		PreviousWeekday,
+		StartOfWeek,
+		EndOfWeek,
+		StartOfMonth,
+		EndOfMonth,
+		StartOfYear,
+		EndOfYear,
+	};
+
+	// A single compiled operation.
+	struct FStep
+	{
+		EOperation Operation = EOperation::AddTicks;
+		int64 Value = 0;
+	};
+
+	// The maximum number of terms in an expression.
+	static constexpr int32 MaxSteps = 8;
+
+public:
+	// Compiles the text. Returns false if the text is not a valid expression.
+	static bool Compile(FStringView Text, FPickableDateTimeQuickEntry& OutExpression);
+
+	// Compiles and evaluates the text in one go.
+	static bool Evaluate(FStringView Text, const FDateTime& Reference, FDateTime& OutDateTime);
+
+	// Evaluates the compiled expression. Returns false if the result is out of the range of FDateTime.
+	bool Evaluate(const FDateTime& Reference, FDateTime& OutDateTime) const;
+
+	// Returns whether nothing has been compiled.
+	bool IsEmpty() const
+	{
+		return (NumSteps == 0);
+	}
+
+private:
+	// The compiled operations.
+	FStep Steps[MaxSteps];
+
+	// The number of valid elements in Steps.
+	int32 NumSteps = 0;
+};